@@ -8,6 +8,7 @@
 // anari
 #include <anari_test_scenes.h>
 // std
+#include <cstdlib>
 #include <iostream>
 
 static const bool g_true = true;
@@ -18,11 +19,28 @@ static std::string g_libraryName = "environment";
 static anari::Library g_debug = nullptr;
 static anari::Device g_device = nullptr;
 static const char *g_traceDir = nullptr;
+static const char *g_recordPath = nullptr;
+static const char *g_playbackPath = nullptr;
+static std::string g_sceneCategory = "demo";
+static std::string g_sceneName = "cornell_box";
+static std::string g_rendererSubtype = "default";
+static anari::math::uint2 g_playbackSize = {1920, 1080};
+static float g_playbackFPS = 30.f;
+static int g_warmupFrames = 1;
 
 extern const char *getDefaultUILayout();
 
 namespace viewer {
 
+extern int runCameraPathPlayback(anari::Device device,
+    const char *pathFile,
+    const char *sceneCategory,
+    const char *sceneName,
+    const char *rendererSubtype,
+    anari::math::uint2 size,
+    float fps,
+    int warmupFrames);
+
 struct AppState
 {
   manipulators::Orbit manipulator;
@@ -128,6 +146,8 @@ class Application : public anari_viewer::Application
 
     auto *viewport = new windows::Viewport(device, "Viewport");
     viewport->setManipulator(&m_state.manipulator);
+    if (g_recordPath)
+      viewport->startCameraPathRecording(g_recordPath);
 
     auto *leditor = new windows::LightsEditor(device);
 
@@ -188,7 +208,12 @@ static void printUsage()
   std::cout << "./anariViewer [{--help|-h}]\n"
             << "   [{--verbose|-v}] [{--debug|-g}]\n"
             << "   [{--library|-l} <ANARI library>]\n"
-            << "   [{--trace|-t} <directory>]\n";
+            << "   [{--trace|-t} <directory>]\n"
+            << "   [--record <camera path file>]\n"
+            << "   [--playback <camera path file>\n"
+            << "      [--scene <category> <name>] [--renderer <subtype>]\n"
+            << "      [--size <width> <height>] [--fps <frames per second>]\n"
+            << "      [--warmup <frames>]]\n";
 }
 
 static void parseCommandLine(int argc, char *argv[])
@@ -208,12 +233,44 @@ static void parseCommandLine(int argc, char *argv[])
       g_enableDebug = true;
     else if (arg == "--trace" || arg == "-t")
       g_traceDir = argv[++i];
+    else if (arg == "--record")
+      g_recordPath = argv[++i];
+    else if (arg == "--playback")
+      g_playbackPath = argv[++i];
+    else if (arg == "--scene") {
+      g_sceneCategory = argv[++i];
+      g_sceneName = argv[++i];
+    } else if (arg == "--renderer")
+      g_rendererSubtype = argv[++i];
+    else if (arg == "--size") {
+      g_playbackSize.x = std::atoi(argv[++i]);
+      g_playbackSize.y = std::atoi(argv[++i]);
+    } else if (arg == "--fps")
+      g_playbackFPS = std::atof(argv[++i]);
+    else if (arg == "--warmup")
+      g_warmupFrames = std::atoi(argv[++i]);
   }
 }
 
 int main(int argc, char *argv[])
 {
   parseCommandLine(argc, argv);
+
+  // Playback is headless: no window or GL context is ever created
+  if (g_playbackPath) {
+    viewer::initializeANARI();
+    const int result = viewer::runCameraPathPlayback(g_device,
+        g_playbackPath,
+        g_sceneCategory.c_str(),
+        g_sceneName.c_str(),
+        g_rendererSubtype.c_str(),
+        g_playbackSize,
+        g_playbackFPS,
+        g_warmupFrames);
+    anari::release(g_device, g_device);
+    return result;
+  }
+
   viewer::Application app;
   app.run(1920, 1200, "ANARI Demo Viewer");
   return 0;
@@ -0,0 +1,157 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "anari_viewer/CameraPath.h"
+// anari
+#include <anari_test_scenes.h>
+#include <anari/anari_cpp/ext/linalg.h>
+#include <anari/anari_cpp.hpp>
+// std
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+// Headless camera path playback: renders every frame of a recorded path with
+// no window or GL context and reports latency percentiles, so interactive
+// workloads can be compared across devices and builds (e.g. on CI machines)
+
+namespace viewer {
+
+using Clock = std::chrono::steady_clock;
+
+static double milliseconds(Clock::duration d)
+{
+  return std::chrono::duration<double, std::milli>(d).count();
+}
+
+static double percentile(const std::vector<double> &sorted, double p)
+{
+  if (sorted.empty())
+    return 0.0;
+  const size_t i = size_t(std::ceil(p / 100.0 * sorted.size()));
+  return sorted[std::clamp<size_t>(i, 1, sorted.size()) - 1];
+}
+
+static void printLatencies(const char *name, std::vector<double> &times)
+{
+  std::sort(times.begin(), times.end());
+  printf("  %-6s %9.2f %9.2f %9.2f %9.2f %9.2f\n",
+      name,
+      percentile(times, 50),
+      percentile(times, 90),
+      percentile(times, 99),
+      times.empty() ? 0.0 : times.back(),
+      times.empty() ? 0.0 : times.front());
+}
+
+int runCameraPathPlayback(anari::Device device,
+    const char *pathFile,
+    const char *sceneCategory,
+    const char *sceneName,
+    const char *rendererSubtype,
+    anari::math::uint2 size,
+    float fps,
+    int warmupFrames)
+{
+  manipulators::CameraPath path;
+  if (!path.load(pathFile) || path.empty()) {
+    fprintf(stderr, "failed to load camera path from '%s'\n", pathFile);
+    return 1;
+  }
+
+  anari::scenes::SceneHandle scene = nullptr;
+  try {
+    scene = anari::scenes::createScene(device, sceneCategory, sceneName);
+    anari::scenes::commit(scene);
+  } catch (const std::runtime_error &e) {
+    fprintf(stderr, "%s\n", e.what());
+    return 1;
+  }
+
+  auto world = anari::scenes::getWorld(scene);
+  auto camera = anari::newObject<anari::Camera>(device, "perspective");
+  auto renderer = anari::newObject<anari::Renderer>(device, rendererSubtype);
+  anari::commitParameters(device, renderer);
+
+  auto frame = anari::newObject<anari::Frame>(device);
+  anari::setParameter(device, frame, "size", size);
+  anari::setParameter(device, frame, "channel.color", ANARI_UFIXED8_RGBA_SRGB);
+  anari::setParameter(device, frame, "world", world);
+  anari::setParameter(device, frame, "camera", camera);
+  anari::setParameter(device, frame, "renderer", renderer);
+  anari::commitParameters(device, frame);
+
+  anari::setParameter(device, camera, "aspect", size.x / float(size.y));
+  anari::setParameter(
+      device, camera, "fovy", float(path.fovy() * M_PI / 180.f));
+
+  manipulators::Orbit orbit;
+
+  auto renderAt = [&](float time, double *render, double *map) {
+    path.apply(time, orbit);
+    anari::setParameter(device, camera, "position", orbit.eye());
+    anari::setParameter(device, camera, "direction", orbit.dir());
+    anari::setParameter(device, camera, "up", orbit.up());
+    anari::commitParameters(device, camera);
+
+    const auto start = Clock::now();
+    anari::render(device, frame);
+    anari::wait(device, frame);
+    const auto rendered = Clock::now();
+    auto fb = anari::map<uint32_t>(device, frame, "channel.color");
+    anari::unmap(device, frame, "channel.color");
+    const auto mapped = Clock::now();
+
+    *render = milliseconds(rendered - start);
+    *map = milliseconds(mapped - rendered);
+    return fb.data != nullptr;
+  };
+
+  // Warmup frames absorb one-time costs (e.g. acceleration structure builds)
+  double render = 0.0, map = 0.0;
+  for (int i = 0; i < warmupFrames; i++)
+    renderAt(0.f, &render, &map);
+
+  const int numFrames = std::max(int(std::ceil(path.duration() * fps)), 0) + 1;
+
+  std::vector<double> renderTimes, mapTimes, totalTimes;
+  int numBadFrames = 0;
+  const auto start = Clock::now();
+  for (int i = 0; i < numFrames; i++) {
+    if (!renderAt(i / fps, &render, &map))
+      numBadFrames++;
+    renderTimes.push_back(render);
+    mapTimes.push_back(map);
+    totalTimes.push_back(render + map);
+  }
+  const double elapsed = milliseconds(Clock::now() - start);
+
+  printf("camera path '%s': %i frames (%.2fs at %.0f fps), %u x %u, "
+         "scene %s/%s\n",
+      pathFile,
+      numFrames,
+      path.duration(),
+      fps,
+      size.x,
+      size.y,
+      sceneCategory,
+      sceneName);
+  printf("  [ms]         p50       p90       p99       max       min\n");
+  printLatencies("render", renderTimes);
+  printLatencies("map", mapTimes);
+  printLatencies("total", totalTimes);
+  printf("  %.2f frames/s overall\n", numFrames / (elapsed / 1000.0));
+  if (numBadFrames)
+    printf("  WARNING: %i frames mapped without color data\n", numBadFrames);
+
+  anari::release(device, frame);
+  anari::release(device, renderer);
+  anari::release(device, camera);
+  anari::scenes::release(scene);
+
+  return numBadFrames ? 1 : 0;
+}
+
+} // namespace viewer
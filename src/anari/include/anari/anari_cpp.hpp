@@ -8,7 +8,9 @@
 #include "anari/frontend/anari_extension_utility.h"
 #include "anari/frontend/type_utility.h"
 // std
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace anari {
 
@@ -139,6 +141,45 @@ Array3D newArray3D(Device d,
     uint64_t numItems2,
     uint64_t numItems3);
 
+// Owned Containers //
+
+// These take ownership of the container's memory instead of copying it: the
+// container is kept alive by the array's deleter until the device is done
+// with it.
+
+template <typename T, typename ALLOC_T>
+Array1D newArray1D(Device, std::vector<T, ALLOC_T> &&);
+
+template <typename T, typename DELETER_T>
+Array1D newArray1D(
+    Device, std::unique_ptr<T[], DELETER_T> &&, uint64_t numItems1);
+
+template <typename T, typename ALLOC_T>
+Array2D newArray2D(Device,
+    std::vector<T, ALLOC_T> &&,
+    uint64_t numItems1,
+    uint64_t numItems2);
+
+template <typename T, typename DELETER_T>
+Array2D newArray2D(Device,
+    std::unique_ptr<T[], DELETER_T> &&,
+    uint64_t numItems1,
+    uint64_t numItems2);
+
+template <typename T, typename ALLOC_T>
+Array3D newArray3D(Device,
+    std::vector<T, ALLOC_T> &&,
+    uint64_t numItems1,
+    uint64_t numItems2,
+    uint64_t numItems3);
+
+template <typename T, typename DELETER_T>
+Array3D newArray3D(Device,
+    std::unique_ptr<T[], DELETER_T> &&,
+    uint64_t numItems1,
+    uint64_t numItems2,
+    uint64_t numItems3);
+
 // Data Updates //
 
 template <typename T>
@@ -195,6 +236,53 @@ void setParameterArray3D(ANARIDevice device,
     uint64_t numElements2,
     uint64_t numElements3);
 
+// Owned Container Array Parameters (no copy) //
+
+template <typename T, typename ALLOC_T>
+void setParameterArray1D(
+    Device d, Object o, const char *name, std::vector<T, ALLOC_T> &&data);
+
+template <typename T, typename DELETER_T>
+void setParameterArray1D(Device d,
+    Object o,
+    const char *name,
+    std::unique_ptr<T[], DELETER_T> &&data,
+    uint64_t numElements1);
+
+template <typename T, typename ALLOC_T>
+void setParameterArray2D(Device d,
+    Object o,
+    const char *name,
+    std::vector<T, ALLOC_T> &&data,
+    uint64_t numElements1,
+    uint64_t numElements2);
+
+template <typename T, typename DELETER_T>
+void setParameterArray2D(Device d,
+    Object o,
+    const char *name,
+    std::unique_ptr<T[], DELETER_T> &&data,
+    uint64_t numElements1,
+    uint64_t numElements2);
+
+template <typename T, typename ALLOC_T>
+void setParameterArray3D(Device d,
+    Object o,
+    const char *name,
+    std::vector<T, ALLOC_T> &&data,
+    uint64_t numElements1,
+    uint64_t numElements2,
+    uint64_t numElements3);
+
+template <typename T, typename DELETER_T>
+void setParameterArray3D(Device d,
+    Object o,
+    const char *name,
+    std::unique_ptr<T[], DELETER_T> &&data,
+    uint64_t numElements1,
+    uint64_t numElements2,
+    uint64_t numElements3);
+
 // Object + Parameter Lifetime Management /////////////////////////////////////
 
 template <typename T>
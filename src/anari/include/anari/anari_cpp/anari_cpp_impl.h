@@ -26,6 +26,20 @@ inline ANARIDataType getType()
   return type;
 }
 
+// Deleter for arrays which own 'CONTAINER_T', which was moved to the heap and
+// passed as the array's deleter user pointer
+template <typename CONTAINER_T>
+inline void deleteOwnedContainer(const void *userPtr, const void *)
+{
+  delete (const CONTAINER_T *)userPtr;
+}
+
+template <typename CONTAINER_T>
+inline CONTAINER_T *moveToHeap(CONTAINER_T &&c)
+{
+  return new CONTAINER_T(std::move(c));
+}
+
 } // namespace detail
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -306,6 +320,101 @@ inline Array3D newArray3D(Device d,
       d, nullptr, nullptr, nullptr, type, numItems1, numItems2, numItems3);
 }
 
+// Owned Containers //
+
+template <typename T, typename ALLOC_T>
+inline Array1D newArray1D(Device d, std::vector<T, ALLOC_T> &&v)
+{
+  using CONTAINER_T = std::vector<T, ALLOC_T>;
+  auto *c = detail::moveToHeap(std::move(v));
+  return newArray1D(d,
+      c->data(),
+      &detail::deleteOwnedContainer<CONTAINER_T>,
+      c,
+      uint64_t(c->size()));
+}
+
+template <typename T, typename DELETER_T>
+inline Array1D newArray1D(
+    Device d, std::unique_ptr<T[], DELETER_T> &&p, uint64_t numItems1)
+{
+  using CONTAINER_T = std::unique_ptr<T[], DELETER_T>;
+  auto *c = detail::moveToHeap(std::move(p));
+  return newArray1D(d,
+      (const T *)c->get(),
+      &detail::deleteOwnedContainer<CONTAINER_T>,
+      c,
+      numItems1);
+}
+
+template <typename T, typename ALLOC_T>
+inline Array2D newArray2D(Device d,
+    std::vector<T, ALLOC_T> &&v,
+    uint64_t numItems1,
+    uint64_t numItems2)
+{
+  using CONTAINER_T = std::vector<T, ALLOC_T>;
+  auto *c = detail::moveToHeap(std::move(v));
+  return newArray2D(d,
+      c->data(),
+      &detail::deleteOwnedContainer<CONTAINER_T>,
+      c,
+      numItems1,
+      numItems2);
+}
+
+template <typename T, typename DELETER_T>
+inline Array2D newArray2D(Device d,
+    std::unique_ptr<T[], DELETER_T> &&p,
+    uint64_t numItems1,
+    uint64_t numItems2)
+{
+  using CONTAINER_T = std::unique_ptr<T[], DELETER_T>;
+  auto *c = detail::moveToHeap(std::move(p));
+  return newArray2D(d,
+      (const T *)c->get(),
+      &detail::deleteOwnedContainer<CONTAINER_T>,
+      c,
+      numItems1,
+      numItems2);
+}
+
+template <typename T, typename ALLOC_T>
+inline Array3D newArray3D(Device d,
+    std::vector<T, ALLOC_T> &&v,
+    uint64_t numItems1,
+    uint64_t numItems2,
+    uint64_t numItems3)
+{
+  using CONTAINER_T = std::vector<T, ALLOC_T>;
+  auto *c = detail::moveToHeap(std::move(v));
+  return newArray3D(d,
+      c->data(),
+      &detail::deleteOwnedContainer<CONTAINER_T>,
+      c,
+      numItems1,
+      numItems2,
+      numItems3);
+}
+
+template <typename T, typename DELETER_T>
+inline Array3D newArray3D(Device d,
+    std::unique_ptr<T[], DELETER_T> &&p,
+    uint64_t numItems1,
+    uint64_t numItems2,
+    uint64_t numItems3)
+{
+  using CONTAINER_T = std::unique_ptr<T[], DELETER_T>;
+  auto *c = detail::moveToHeap(std::move(p));
+  return newArray3D(d,
+      (const T *)c->get(),
+      &detail::deleteOwnedContainer<CONTAINER_T>,
+      c,
+      numItems1,
+      numItems2,
+      numItems3);
+}
+
 // Data Updates //
 
 template <typename T>
@@ -445,6 +554,79 @@ inline void setParameterArray3D(Device d,
       numElements3);
 }
 
+// Owned Container Array Parameters (no copy) //
+
+template <typename T, typename ALLOC_T>
+inline void setParameterArray1D(
+    Device d, Object o, const char *name, std::vector<T, ALLOC_T> &&v)
+{
+  setAndReleaseParameter(d, o, name, newArray1D(d, std::move(v)));
+}
+
+template <typename T, typename DELETER_T>
+inline void setParameterArray1D(Device d,
+    Object o,
+    const char *name,
+    std::unique_ptr<T[], DELETER_T> &&v,
+    uint64_t numElements1)
+{
+  setAndReleaseParameter(d, o, name, newArray1D(d, std::move(v), numElements1));
+}
+
+template <typename T, typename ALLOC_T>
+inline void setParameterArray2D(Device d,
+    Object o,
+    const char *name,
+    std::vector<T, ALLOC_T> &&v,
+    uint64_t numElements1,
+    uint64_t numElements2)
+{
+  setAndReleaseParameter(
+      d, o, name, newArray2D(d, std::move(v), numElements1, numElements2));
+}
+
+template <typename T, typename DELETER_T>
+inline void setParameterArray2D(Device d,
+    Object o,
+    const char *name,
+    std::unique_ptr<T[], DELETER_T> &&v,
+    uint64_t numElements1,
+    uint64_t numElements2)
+{
+  setAndReleaseParameter(
+      d, o, name, newArray2D(d, std::move(v), numElements1, numElements2));
+}
+
+template <typename T, typename ALLOC_T>
+inline void setParameterArray3D(Device d,
+    Object o,
+    const char *name,
+    std::vector<T, ALLOC_T> &&v,
+    uint64_t numElements1,
+    uint64_t numElements2,
+    uint64_t numElements3)
+{
+  setAndReleaseParameter(d,
+      o,
+      name,
+      newArray3D(d, std::move(v), numElements1, numElements2, numElements3));
+}
+
+template <typename T, typename DELETER_T>
+inline void setParameterArray3D(Device d,
+    Object o,
+    const char *name,
+    std::unique_ptr<T[], DELETER_T> &&v,
+    uint64_t numElements1,
+    uint64_t numElements2,
+    uint64_t numElements3)
+{
+  setAndReleaseParameter(d,
+      o,
+      name,
+      newArray3D(d, std::move(v), numElements1, numElements2, numElements3));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Object + Parameter Lifetime Management /////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -117,7 +117,7 @@ void GravityVolume::commit()
   anari::setParameter(d, field, "origin", math::float3(-1.f));
   anari::setParameter(d, field, "spacing", math::float3(2.f / volumeDims));
   anari::setParameterArray3D(
-      d, field, "data", voxels.data(), volumeDims, volumeDims, volumeDims);
+      d, field, "data", std::move(voxels), volumeDims, volumeDims, volumeDims);
   anari::commitParameters(d, field);
 
   auto volume = anari::newObject<anari::Volume>(d, "transferFunction1D");
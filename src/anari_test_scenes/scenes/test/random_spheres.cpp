@@ -84,13 +84,9 @@ void RandomSpheres::commit()
     s.w = 1.f;
   }
 
-  anari::setParameterArray1D(d,
-      geom,
-      "vertex.position",
-      spherePositions.data(),
-      spherePositions.size());
   anari::setParameterArray1D(
-      d, geom, "vertex.color", sphereColors.data(), sphereColors.size());
+      d, geom, "vertex.position", std::move(spherePositions));
+  anari::setParameterArray1D(d, geom, "vertex.color", std::move(sphereColors));
 
   if (randomizeRadii) {
     std::normal_distribution<float> radii_dist(radius / 10.f, radius);
@@ -99,8 +95,7 @@ void RandomSpheres::commit()
     for (auto &r : sphereRadii)
       r = std::fabs(radii_dist(rng));
 
-    anari::setParameterArray1D(
-        d, geom, "vertex.radius", sphereRadii.data(), sphereRadii.size());
+    anari::setParameterArray1D(d, geom, "vertex.radius", std::move(sphereRadii));
   }
 
   anari::commitParameters(d, geom);
@@ -0,0 +1,180 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "CameraPath.h"
+// std
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+namespace manipulators {
+
+// Helper functions ///////////////////////////////////////////////////////////
+
+// Interpolate angles the short way around, so a path crossing 0/360 degrees
+// does not sweep back through the whole circle
+static float lerpDegrees(float a, float b, float t)
+{
+  float delta = std::fmod(b - a, 360.f);
+  if (delta > 180.f)
+    delta -= 360.f;
+  else if (delta < -180.f)
+    delta += 360.f;
+  return a + delta * t;
+}
+
+// CameraPath definitions /////////////////////////////////////////////////////
+
+void CameraPath::clear()
+{
+  m_keys.clear();
+}
+
+void CameraPath::addKey(float time, const Orbit &orbit)
+{
+  CameraPathKey key;
+  key.time = time;
+  key.azel = orbit.azel();
+  key.distance = orbit.distance();
+  key.at = orbit.at();
+  m_keys.push_back(key);
+}
+
+bool CameraPath::empty() const
+{
+  return m_keys.empty();
+}
+
+size_t CameraPath::size() const
+{
+  return m_keys.size();
+}
+
+float CameraPath::duration() const
+{
+  return empty() ? 0.f : m_keys.back().time - m_keys.front().time;
+}
+
+CameraPathKey CameraPath::keyAt(float time) const
+{
+  if (empty())
+    return {};
+
+  time += m_keys.front().time;
+
+  auto next = std::upper_bound(m_keys.begin(),
+      m_keys.end(),
+      time,
+      [](float t, const CameraPathKey &k) { return t < k.time; });
+  if (next == m_keys.begin())
+    return m_keys.front();
+  else if (next == m_keys.end())
+    return m_keys.back();
+
+  const auto &k0 = *(next - 1);
+  const auto &k1 = *next;
+  const float span = k1.time - k0.time;
+  const float t = span > 0.f ? (time - k0.time) / span : 0.f;
+
+  CameraPathKey key;
+  key.time = time;
+  key.azel.x = lerpDegrees(k0.azel.x, k1.azel.x, t);
+  key.azel.y = lerpDegrees(k0.azel.y, k1.azel.y, t);
+  key.distance = linalg::lerp(k0.distance, k1.distance, t);
+  key.at = linalg::lerp(k0.at, k1.at, t);
+  return key;
+}
+
+void CameraPath::apply(float time, Orbit &orbit) const
+{
+  const auto key = keyAt(time);
+  orbit.setAxis(m_axis);
+  orbit.setConfig(key.at, key.distance, key.azel);
+}
+
+OrbitAxis CameraPath::axis() const
+{
+  return m_axis;
+}
+
+void CameraPath::setAxis(OrbitAxis axis)
+{
+  m_axis = axis;
+}
+
+float CameraPath::fovy() const
+{
+  return m_fovy;
+}
+
+void CameraPath::setFovy(float fovy)
+{
+  m_fovy = fovy;
+}
+
+bool CameraPath::save(const std::string &filename) const
+{
+  std::ofstream out(filename);
+  if (!out)
+    return false;
+
+  out << "# anariViewer camera path\n";
+  out << "axis " << int(m_axis) << '\n';
+  out << "fovy " << m_fovy << '\n';
+  out << "# time azimuth elevation distance at.x at.y at.z\n";
+  for (const auto &k : m_keys) {
+    out << k.time << ' ' << k.azel.x << ' ' << k.azel.y << ' ' << k.distance
+        << ' ' << k.at.x << ' ' << k.at.y << ' ' << k.at.z << '\n';
+  }
+
+  return bool(out);
+}
+
+bool CameraPath::load(const std::string &filename)
+{
+  std::ifstream in(filename);
+  if (!in)
+    return false;
+
+  std::vector<CameraPathKey> keys;
+  OrbitAxis axis = OrbitAxis::POS_Y;
+  float fovy = 40.f;
+
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#')
+      continue;
+
+    std::istringstream ls(line);
+    if (line.rfind("axis", 0) == 0) {
+      std::string label;
+      int a = 0;
+      ls >> label >> a;
+      axis = static_cast<OrbitAxis>(std::clamp(a, 0, 5));
+    } else if (line.rfind("fovy", 0) == 0) {
+      std::string label;
+      ls >> label >> fovy;
+    } else {
+      CameraPathKey k;
+      ls >> k.time >> k.azel.x >> k.azel.y >> k.distance >> k.at.x >> k.at.y
+          >> k.at.z;
+      if (!ls)
+        return false;
+      keys.push_back(k);
+    }
+  }
+
+  std::stable_sort(keys.begin(),
+      keys.end(),
+      [](const CameraPathKey &a, const CameraPathKey &b) {
+        return a.time < b.time;
+      });
+
+  m_keys = std::move(keys);
+  m_axis = axis;
+  m_fovy = fovy;
+  return true;
+}
+
+} // namespace manipulators
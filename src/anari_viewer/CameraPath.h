@@ -0,0 +1,55 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Orbit.h"
+// std
+#include <string>
+#include <vector>
+
+namespace manipulators {
+
+struct CameraPathKey
+{
+  float time{0.f}; // seconds since the start of the path
+  anari::math::float2 azel{0.f}; // NOTE: degrees
+  float distance{1.f};
+  anari::math::float3 at{0.f};
+};
+
+// Orbit camera configurations over time, recorded from interactive use and
+// played back (e.g. headless) to reproduce the same camera motion
+class CameraPath
+{
+ public:
+  CameraPath() = default;
+
+  void clear();
+  void addKey(float time, const Orbit &orbit);
+
+  bool empty() const;
+  size_t size() const;
+  float duration() const;
+
+  // Linearly interpolated configuration at 'time', clamped to the path
+  CameraPathKey keyAt(float time) const;
+  void apply(float time, Orbit &orbit) const;
+
+  OrbitAxis axis() const;
+  void setAxis(OrbitAxis axis);
+
+  float fovy() const; // NOTE: degrees
+  void setFovy(float fovy);
+
+  // Plain text: a short header followed by one key per line
+  bool save(const std::string &filename) const;
+  bool load(const std::string &filename);
+
+ private:
+  std::vector<CameraPathKey> m_keys;
+  OrbitAxis m_axis{OrbitAxis::POS_Y};
+  float m_fovy{40.f};
+};
+
+} // namespace manipulators
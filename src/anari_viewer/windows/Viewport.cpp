@@ -77,6 +77,9 @@ Viewport::Viewport(anari::Device device, const char *name)
 
 Viewport::~Viewport()
 {
+  if (m_recordingCameraPath)
+    stopCameraPathRecording();
+
   cancelFrame();
   anari::wait(m_device, m_frame);
 
@@ -100,6 +103,9 @@ void Viewport::buildUI()
   updateImage();
   updateCamera();
 
+  if (m_recordingCameraPath)
+    recordCameraPathKey();
+
   ImGui::Image((void *)(intptr_t)m_framebufferTexture,
       ImGui::GetContentRegionAvail(),
       ImVec2(1, 0),
@@ -166,6 +172,36 @@ anari::Device Viewport::device() const
   return m_device;
 }
 
+void Viewport::startCameraPathRecording(const std::string &filename)
+{
+  m_cameraPath.clear();
+  m_cameraPath.setAxis(m_arcball->axis());
+  m_cameraPath.setFovy(m_fov);
+  m_cameraPathFilename = filename;
+  m_cameraPathStart = std::chrono::steady_clock::now();
+  m_recordingCameraPath = true;
+  recordCameraPathKey();
+}
+
+void Viewport::stopCameraPathRecording()
+{
+  m_recordingCameraPath = false;
+  if (m_cameraPath.save(m_cameraPathFilename)) {
+    printf("camera path (%zu keys, %.2fs) saved to '%s'\n",
+        m_cameraPath.size(),
+        m_cameraPath.duration(),
+        m_cameraPathFilename.c_str());
+  } else {
+    printf("failed to save camera path to '%s'\n",
+        m_cameraPathFilename.c_str());
+  }
+}
+
+bool Viewport::isRecordingCameraPath() const
+{
+  return m_recordingCameraPath;
+}
+
 void Viewport::reshape(anari::math::int2 newSize)
 {
   if (newSize.x <= 0 || newSize.y <= 0)
@@ -304,6 +340,13 @@ void Viewport::cancelFrame()
   anari::discard(m_device, m_frame);
 }
 
+void Viewport::recordCameraPathKey()
+{
+  const std::chrono::duration<float> time =
+      std::chrono::steady_clock::now() - m_cameraPathStart;
+  m_cameraPath.addKey(time.count(), *m_arcball);
+}
+
 void Viewport::ui_handleInput()
 {
   ImGuiIO &io = ImGui::GetIO();
@@ -420,6 +463,11 @@ void Viewport::ui_contextMenu()
     if (ImGui::MenuItem("reset view"))
       resetView();
 
+    if (!m_recordingCameraPath && ImGui::MenuItem("record path"))
+      startCameraPathRecording(m_cameraPathFilename);
+    else if (m_recordingCameraPath && ImGui::MenuItem("stop recording path"))
+      stopCameraPathRecording();
+
     ImGui::Unindent(INDENT_AMOUNT);
     ImGui::Separator();
 
@@ -497,6 +545,9 @@ void Viewport::ui_overlay()
   ImGui::Text("   (min): %.2fms", m_minFL);
   ImGui::Text("   (max): %.2fms", m_maxFL);
 
+  if (m_recordingCameraPath)
+    ImGui::Text("recording camera path...");
+
   ImGui::Separator();
 
   static bool showCameraInfo = false;
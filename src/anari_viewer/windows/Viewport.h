@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../CameraPath.h"
 #include "../Orbit.h"
 #include "../ui_anari.h"
 // glad
@@ -14,7 +15,9 @@
 #include <anari/anari_cpp.hpp>
 // std
 #include <array>
+#include <chrono>
 #include <limits>
+#include <string>
 
 #include "Window.h"
 
@@ -35,6 +38,12 @@ struct Viewport : public anari_viewer::Window
 
   anari::Device device() const;
 
+  // Record the camera every UI frame until stopped, then save the path to
+  // 'filename' (see manipulators::CameraPath)
+  void startCameraPathRecording(const std::string &filename);
+  void stopCameraPathRecording();
+  bool isRecordingCameraPath() const;
+
  private:
   void reshape(anari::math::int2 newWindowSize);
 
@@ -43,6 +52,7 @@ struct Viewport : public anari_viewer::Window
   void updateCamera(bool force = false);
   void updateImage();
   void cancelFrame();
+  void recordCameraPathKey();
 
   void ui_handleInput();
   void ui_contextMenu();
@@ -88,6 +98,13 @@ struct Viewport : public anari_viewer::Window
   manipulators::Orbit *m_arcball{nullptr};
   manipulators::UpdateToken m_cameraToken{0};
 
+  // camera path recording
+
+  bool m_recordingCameraPath{false};
+  manipulators::CameraPath m_cameraPath;
+  std::string m_cameraPathFilename{"camera_path.txt"};
+  std::chrono::steady_clock::time_point m_cameraPathStart;
+
   // OpenGL + display
 
   GLuint m_framebufferTexture{0};
@@ -22,14 +22,32 @@ namespace helide {
 
 void *HelideDevice::mapArray(ANARIArray a)
 {
-  deviceState()->renderingSemaphore.arrayMapAcquire();
+  auto &array = helium::referenceFromHandle<helium::Array>(a);
+  auto &semaphore = deviceState()->renderingSemaphore;
+
+  // Frames (or BLS builds) in flight keep reading the current version of
+  // managed arrays, so those are mapped into a new version instead of waiting
+  if (!array.supportsVersionedMap()) {
+    deviceState()->waitOnBVHBuilds();
+    deviceState()->waitOnBVHPrebuilds();
+    semaphore.arrayMapAcquire();
+  } else if (deviceState()->bvhBuildsPending()
+      || deviceState()->bvhPrebuildsPending()
+      || !semaphore.tryArrayMapAcquire()) {
+    auto lock = array.scopeLockObject();
+    return array.mapNewVersion();
+  }
+
   return helium::BaseDevice::mapArray(a);
 }
 
 void HelideDevice::unmapArray(ANARIArray a)
 {
+  auto &array = helium::referenceFromHandle<helium::Array>(a);
+  const bool mappedNewVersion = array.isMappedAsNewVersion();
   helium::BaseDevice::unmapArray(a);
-  deviceState()->renderingSemaphore.arrayMapRelease();
+  if (!mappedNewVersion)
+    deviceState()->renderingSemaphore.arrayMapRelease();
 }
 
 // API Objects ////////////////////////////////////////////////////////////////
@@ -121,10 +139,10 @@ ANARIGroup HelideDevice::newGroup()
   return (ANARIGroup) new Group(deviceState());
 }
 
-ANARIInstance HelideDevice::newInstance(const char * /*subtype*/)
+ANARIInstance HelideDevice::newInstance(const char *subtype)
 {
   initDevice();
-  return (ANARIInstance) new Instance(deviceState());
+  return (ANARIInstance)Instance::createInstance(subtype, deviceState());
 }
 
 ANARILight HelideDevice::newLight(const char *subtype)
@@ -219,11 +237,45 @@ int HelideDevice::getProperty(ANARIObject object,
   if (mask == ANARI_WAIT) {
     auto lock = scopeLockObject();
     deviceState()->waitOnCurrentFrame();
+    deviceState()->waitOnBVHBuilds();
+    deviceState()->waitOnBVHPrebuilds();
   }
 
   return helium::BaseDevice::getProperty(object, name, type, mem, size, mask);
 }
 
+void HelideDevice::commitParameters(ANARIObject o)
+{
+  helium::BaseDevice::commitParameters(o);
+
+  auto &state = *deviceState();
+  if (!state.bvhBuilds.eager || handleIsDevice(o))
+    return;
+
+  const auto type = ((helium::BaseObject *)o)->type();
+  if (type != ANARI_GROUP && type != ANARI_GEOMETRY)
+    return;
+
+  // A frame in flight reads the objects being flushed, so leave them to that
+  // frame's own flush rather than blocking the app on it
+  if (!state.renderingSemaphore.tryArrayMapAcquire())
+    return;
+
+  // Only commit what a BLS is built from, then start the builds right away
+  // instead of when the next frame is rendered. Geometries may be read by
+  // builds still in flight, so while there are any only groups are committed
+  // (each waits on its own previous build).
+  {
+    auto lock = scopeLockObject();
+    if (state.bvhBuildsPending() || state.bvhPrebuildsPending())
+      state.commitBufferFlush({ANARI_GROUP});
+    else
+      state.commitBufferFlush(blsSourceTypes());
+    state.scheduleStaleBVHBuilds();
+  }
+  state.renderingSemaphore.arrayMapRelease();
+}
+
 // Other HelideDevice definitions /////////////////////////////////////////////
 
 HelideDevice::HelideDevice(ANARIStatusCallback cb, const void *ptr)
@@ -243,7 +295,10 @@ HelideDevice::~HelideDevice()
 {
   auto &state = *deviceState();
 
+  state.waitOnBVHBuilds();
+  state.waitOnBVHPrebuilds();
   state.commitBufferClear();
+  state.waitForReclamation(); // objects may still hold embree handles
 
   reportMessage(ANARI_SEVERITY_DEBUG, "destroying helide device (%p)", this);
 
@@ -290,8 +345,14 @@ void HelideDevice::deviceCommitParameters()
   state.invalidMaterialColor =
       getParam<float4>("invalidMaterialColor", float4(1.f, 0.f, 1.f, 1.f));
 
-  if (allowInvalidSurfaceMaterials != state.allowInvalidSurfaceMaterials)
-    state.objectUpdates.lastBLSReconstructSceneRequest = helium::newTimeStamp();
+  if (allowInvalidSurfaceMaterials != state.allowInvalidSurfaceMaterials) {
+    auto &updates = state.objectUpdates;
+    updates.lastBLSReconstructSceneRequest = helium::newTimeStamp();
+    updates.lastBLSReconstructAllRequest =
+        updates.lastBLSReconstructSceneRequest;
+  }
+
+  state.bvhBuilds.eager = getParam<bool>("eagerBVHBuild", false);
 
   helium::BaseDevice::deviceCommitParameters();
 }
@@ -306,6 +367,21 @@ int HelideDevice::deviceGetProperty(
   } else if (prop == "helide" && type == ANARI_BOOL) {
     helium::writeToVoidP(mem, true);
     return 1;
+  } else if (prop == "bvhBuildsPending" && type == ANARI_UINT32) {
+    auto &builds = deviceState()->bvhBuilds;
+    std::lock_guard<std::mutex> lock(builds.mutex);
+    helium::writeToVoidP(mem, builds.pending);
+    return 1;
+  } else if (prop == "bvhBuildTime" && type == ANARI_FLOAT32) {
+    auto &builds = deviceState()->bvhBuilds;
+    std::lock_guard<std::mutex> lock(builds.mutex);
+    helium::writeToVoidP(mem, builds.buildTime);
+    return 1;
+  } else if (prop == "bvhBuildWaitTime" && type == ANARI_FLOAT32) {
+    auto &builds = deviceState()->bvhBuilds;
+    std::lock_guard<std::mutex> lock(builds.mutex);
+    helium::writeToVoidP(mem, builds.waitTime);
+    return 1;
   }
   return 0;
 }
@@ -79,6 +79,8 @@ struct HelideDevice : public helium::BaseDevice
       uint64_t size,
       uint32_t mask) override;
 
+  void commitParameters(ANARIObject o) override;
+
   /////////////////////////////////////////////////////////////////////////////
   // Helper/other functions and data members
   /////////////////////////////////////////////////////////////////////////////
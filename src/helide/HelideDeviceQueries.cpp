@@ -9,7 +9,7 @@
 #include <anari/anari.h>
 namespace helide {
 static int subtype_hash(const char *str) {
-   static const uint32_t table[] = {0x80000000u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7a6f0075u,0x6665008eu,0x0u,0x0u,0x0u,0x0u,0x6e6d0095u,0x0u,0x0u,0x0u,0x626100a2u,0x0u,0x737200a7u,0x736500b3u,0x767500d3u,0x0u,0x757000d7u,0x737200f1u,0x6f6e0080u,0x0u,0x0u,0x0u,0x0u,0x0u,0x73720083u,0x0u,0x0u,0x0u,0x6d6c0087u,0x66650081u,0x1000082u,0x80000001u,0x77760084u,0x66650085u,0x1000086u,0x80000002u,0x6a690088u,0x6f6e0089u,0x6564008au,0x6665008bu,0x7372008cu,0x100008du,0x80000003u,0x6766008fu,0x62610090u,0x76750091u,0x6d6c0092u,0x75740093u,0x1000094u,0x80000004u,0x62610096u,0x68670097u,0x66650098u,0x34310099u,0x4544009cu,0x4544009eu,0x454400a0u,0x100009du,0x80000005u,0x100009fu,0x80000006u,0x10000a1u,0x80000007u,0x757400a3u,0x757400a4u,0x666500a5u,0x10000a6u,0x80000008u,0x757400a8u,0x696800a9u,0x706f00aau,0x686700abu,0x737200acu,0x626100adu,0x717000aeu,0x696800afu,0x6a6900b0u,0x646300b1u,0x10000b2u,0x80000009u,0x737200c1u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a6900cbu,0x747300c2u,0x717000c3u,0x666500c4u,0x646300c5u,0x757400c6u,0x6a6900c7u,0x777600c8u,0x666500c9u,0x10000cau,0x8000000au,0x6e6d00ccu,0x6a6900cdu,0x757400ceu,0x6a6900cfu,0x777600d0u,0x666500d1u,0x10000d2u,0x8000000bu,0x626100d4u,0x656400d5u,0x10000d6u,0x8000000cu,0x696800dcu,0x0u,0x0u,0x0u,0x737200e1u,0x666500ddu,0x737200deu,0x666500dfu,0x10000e0u,0x8000000du,0x767500e2u,0x646300e3u,0x757400e4u,0x767500e5u,0x737200e6u,0x666500e7u,0x656400e8u,0x535200e9u,0x666500eau,0x686700ebu,0x767500ecu,0x6d6c00edu,0x626100eeu,0x737200efu,0x10000f0u,0x8000000eu,0x6a6100f2u,0x6f6e00fbu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610118u,0x747300fcu,0x676600fdu,0x706500feu,0x73720109u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x73720115u,0x4746010au,0x7675010bu,0x6f6e010cu,0x6463010du,0x7574010eu,0x6a69010fu,0x706f0110u,0x6f6e0111u,0x32310112u,0x45440113u,0x1000114u,0x8000000fu,0x6e6d0116u,0x1000117u,0x80000010u,0x6f6e0119u,0x6867011au,0x6d6c011bu,0x6665011cu,0x100011du,0x80000011u};
+   static const uint32_t table[] = {0x80000000u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7a6f0075u,0x6665008eu,0x0u,0x0u,0x0u,0x0u,0x6e6d0095u,0x0u,0x0u,0x706f00a2u,0x626100a5u,0x0u,0x737200aau,0x736500b6u,0x767500d6u,0x0u,0x757000dau,0x737200f4u,0x6f6e0080u,0x0u,0x0u,0x0u,0x0u,0x0u,0x73720083u,0x0u,0x0u,0x0u,0x6d6c0087u,0x66650081u,0x1000082u,0x80000001u,0x77760084u,0x66650085u,0x1000086u,0x80000002u,0x6a690088u,0x6f6e0089u,0x6564008au,0x6665008bu,0x7372008cu,0x100008du,0x80000003u,0x6766008fu,0x62610090u,0x76750091u,0x6d6c0092u,0x75740093u,0x1000094u,0x80000004u,0x62610096u,0x68670097u,0x66650098u,0x34310099u,0x4544009cu,0x4544009eu,0x454400a0u,0x100009du,0x80000005u,0x100009fu,0x80000006u,0x10000a1u,0x80000007u,0x656400a3u,0x10000a4u,0x80000008u,0x757400a6u,0x757400a7u,0x666500a8u,0x10000a9u,0x80000009u,0x757400abu,0x696800acu,0x706f00adu,0x686700aeu,0x737200afu,0x626100b0u,0x717000b1u,0x696800b2u,0x6a6900b3u,0x646300b4u,0x10000b5u,0x8000000au,0x737200c4u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a6900ceu,0x747300c5u,0x717000c6u,0x666500c7u,0x646300c8u,0x757400c9u,0x6a6900cau,0x777600cbu,0x666500ccu,0x10000cdu,0x8000000bu,0x6e6d00cfu,0x6a6900d0u,0x757400d1u,0x6a6900d2u,0x777600d3u,0x666500d4u,0x10000d5u,0x8000000cu,0x626100d7u,0x656400d8u,0x10000d9u,0x8000000du,0x696800dfu,0x0u,0x0u,0x0u,0x737200e4u,0x666500e0u,0x737200e1u,0x666500e2u,0x10000e3u,0x8000000eu,0x767500e5u,0x646300e6u,0x757400e7u,0x767500e8u,0x737200e9u,0x666500eau,0x656400ebu,0x535200ecu,0x666500edu,0x686700eeu,0x767500efu,0x6d6c00f0u,0x626100f1u,0x737200f2u,0x10000f3u,0x8000000fu,0x6a6100f5u,0x6f6e00feu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261011bu,0x747300ffu,0x67660100u,0x70650101u,0x7372010cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x73720118u,0x4746010du,0x7675010eu,0x6f6e010fu,0x64630110u,0x75740111u,0x6a690112u,0x706f0113u,0x6f6e0114u,0x32310115u,0x45440116u,0x1000117u,0x80000010u,0x6e6d0119u,0x100011au,0x80000011u,0x6f6e011cu,0x6867011du,0x6d6c011eu,0x6665011fu,0x1000120u,0x80000012u};
    uint32_t cur = 0x75000000u;
    for(int i = 0;cur!=0;++i) {
       uint32_t idx = cur&0xFFFFu;
@@ -31,7 +31,7 @@ static int subtype_hash(const char *str) {
    return -1;
 }
 static int param_hash(const char *str) {
-   static const uint32_t table[] = {0x756c0017u,0x62610075u,0x7061007fu,0x6a6100d7u,0x0u,0x706100ebu,0x73650104u,0x6665011du,0x6f640123u,0x0u,0x0u,0x6a6901f1u,0x706101f6u,0x6661020fu,0x7670021au,0x736f0241u,0x0u,0x66610291u,0x766902a2u,0x73720328u,0x716e0331u,0x70610340u,0x736f0408u,0x716c0020u,0x6362004fu,0x0u,0x0u,0x0u,0x0u,0x7372005du,0x71700061u,0x75740066u,0x706f0025u,0x0u,0x0u,0x0u,0x69680038u,0x78770026u,0x4a490027u,0x6f6e0028u,0x77760029u,0x6261002au,0x6d6c002bu,0x6a69002cu,0x6564002du,0x4e4d002eu,0x6261002fu,0x75740030u,0x66650031u,0x73720032u,0x6a690033u,0x62610034u,0x6d6c0035u,0x74730036u,0x1000037u,0x80000000u,0x62610039u,0x4e43003au,0x76750045u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f004bu,0x75740046u,0x706f0047u,0x67660048u,0x67660049u,0x100004au,0x80000001u,0x6564004cu,0x6665004du,0x100004eu,0x80000002u,0x6a690050u,0x66650051u,0x6f6e0052u,0x75740053u,0x53520054u,0x62610055u,0x65640056u,0x6a690057u,0x62610058u,0x6f6e0059u,0x6463005au,0x6665005bu,0x100005cu,0x80000003u,0x6261005eu,0x7a79005fu,0x1000060u,0x80000004u,0x66650062u,0x64630063u,0x75740064u,0x1000065u,0x80000005u,0x73720067u,0x6a690068u,0x63620069u,0x7675006au,0x7574006bu,0x6665006cu,0x3430006du,0x1000071u,0x1000072u,0x1000073u,0x1000074u,0x80000006u,0x80000007u,0x80000008u,0x80000009u,0x64630076u,0x6c6b0077u,0x68670078u,0x73720079u,0x706f007au,0x7675007bu,0x6f6e007cu,0x6564007du,0x100007eu,0x8000000au,0x716d008eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610098u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c00d3u,0x66650092u,0x0u,0x0u,0x74730096u,0x73720093u,0x62610094u,0x1000095u,0x8000000bu,0x1000097u,0x8000000cu,0x6f6e0099u,0x6f6e009au,0x6665009bu,0x6d6c009cu,0x2f2e009du,0x7163009eu,0x706f00acu,0x666500b1u,0x0u,0x0u,0x0u,0x0u,0x6f6e00b6u,0x0u,0x0u,0x0u,0x0u,0x0u,0x636200c0u,0x737200c8u,0x6d6c00adu,0x706f00aeu,0x737200afu,0x10000b0u,0x8000000du,0x717000b2u,0x757400b3u,0x696800b4u,0x10000b5u,0x8000000eu,0x747300b7u,0x757400b8u,0x626100b9u,0x6f6e00bau,0x646300bbu,0x666500bcu,0x4a4900bdu,0x656400beu,0x10000bfu,0x8000000fu,0x6b6a00c1u,0x666500c2u,0x646300c3u,0x757400c4u,0x4a4900c5u,0x656400c6u,0x10000c7u,0x80000010u,0x6a6900c9u,0x6e6d00cau,0x6a6900cbu,0x757400ccu,0x6a6900cdu,0x777600ceu,0x666500cfu,0x4a4900d0u,0x656400d1u,0x10000d2u,0x80000011u,0x706f00d4u,0x737200d5u,0x10000d6u,0x80000012u,0x757400e0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x737200e3u,0x626100e1u,0x10000e2u,0x80000013u,0x666500e4u,0x646300e5u,0x757400e6u,0x6a6900e7u,0x706f00e8u,0x6f6e00e9u,0x10000eau,0x80000014u,0x737200fau,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c00fcu,0x0u,0x0u,0x0u,0x0u,0x0u,0x77760101u,0x10000fbu,0x80000015u,0x757400fdu,0x666500feu,0x737200ffu,0x1000100u,0x80000016u,0x7a790102u,0x1000103u,0x80000017u,0x706f0112u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0119u,0x6e6d0113u,0x66650114u,0x75740115u,0x73720116u,0x7a790117u,0x1000118u,0x80000018u,0x7675011au,0x7170011bu,0x100011cu,0x80000019u,0x6a69011eu,0x6867011fu,0x69680120u,0x75740121u,0x1000122u,0x8000001au,0x100012eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261012fu,0x7741018bu,0x8000001bu,0x68670130u,0x66650131u,0x53000132u,0x8000001cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x66650185u,0x68670186u,0x6a690187u,0x706f0188u,0x6f6e0189u,0x100018au,0x8000001du,0x757401c1u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x676601cau,0x0u,0x0u,0x0u,0x0u,0x737201d0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x757401d9u,0x0u,0x0u,0x626101dfu,0x757401c2u,0x737201c3u,0x6a6901c4u,0x636201c5u,0x767501c6u,0x757401c7u,0x666501c8u,0x10001c9u,0x8000001eu,0x676601cbu,0x747301ccu,0x666501cdu,0x757401ceu,0x10001cfu,0x8000001fu,0x626101d1u,0x6f6e01d2u,0x747301d3u,0x676601d4u,0x706f01d5u,0x737201d6u,0x6e6d01d7u,0x10001d8u,0x80000020u,0x626101dau,0x6f6e01dbu,0x646301dcu,0x666501ddu,0x10001deu,0x80000021u,0x6d6c01e0u,0x6a6901e1u,0x656401e2u,0x4e4d01e3u,0x626101e4u,0x757401e5u,0x666501e6u,0x737201e7u,0x6a6901e8u,0x626101e9u,0x6d6c01eau,0x444301ebu,0x706f01ecu,0x6d6c01edu,0x706f01eeu,0x737201efu,0x10001f0u,0x80000022u,0x686701f2u,0x696801f3u,0x757401f4u,0x10001f5u,0x80000023u,0x75740205u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6564020cu,0x66650206u,0x73720207u,0x6a690208u,0x62610209u,0x6d6c020au,0x100020bu,0x80000024u,0x6665020du,0x100020eu,0x80000025u,0x6e6d0214u,0x0u,0x0u,0x0u,0x62610217u,0x66650215u,0x1000216u,0x80000026u,0x73720218u,0x1000219u,0x80000027u,0x62610220u,0x0u,0x6a690226u,0x0u,0x0u,0x7574022bu,0x64630221u,0x6a690222u,0x75740223u,0x7a790224u,0x1000225u,0x80000028u,0x68670227u,0x6a690228u,0x6f6e0229u,0x100022au,0x80000029u,0x554f022cu,0x67660232u,0x0u,0x0u,0x0u,0x0u,0x73720238u,0x67660233u,0x74730234u,0x66650235u,0x75740236u,0x1000237u,0x8000002au,0x62610239u,0x6f6e023au,0x7473023bu,0x6766023cu,0x706f023du,0x7372023eu,0x6e6d023fu,0x1000240u,0x8000002bu,0x74730245u,0x0u,0x0u,0x6a69024cu,0x6a690246u,0x75740247u,0x6a690248u,0x706f0249u,0x6f6e024au,0x100024bu,0x8000002cu,0x6e6d024du,0x6a69024eu,0x7574024fu,0x6a690250u,0x77760251u,0x66650252u,0x2f2e0253u,0x73610254u,0x75740266u,0x0u,0x706f0276u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6f64027bu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261028bu,0x75740267u,0x73720268u,0x6a690269u,0x6362026au,0x7675026bu,0x7574026cu,0x6665026du,0x3430026eu,0x1000272u,0x1000273u,0x1000274u,0x1000275u,0x8000002du,0x8000002eu,0x8000002fu,0x80000030u,0x6d6c0277u,0x706f0278u,0x73720279u,0x100027au,0x80000031u,0x1000286u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x65640287u,0x80000032u,0x66650288u,0x79780289u,0x100028au,0x80000033u,0x6564028cu,0x6a69028du,0x7675028eu,0x7473028fu,0x1000290u,0x80000034u,0x65640296u,0x0u,0x0u,0x0u,0x6f6e029bu,0x6a690297u,0x76750298u,0x74730299u,0x100029au,0x80000035u,0x6564029cu,0x6665029du,0x7372029eu,0x6665029fu,0x737202a0u,0x10002a1u,0x80000036u,0x7b7a02afu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626102b2u,0x0u,0x0u,0x0u,0x626102b8u,0x73720322u,0x666502b0u,0x10002b1u,0x80000037u,0x646302b3u,0x6a6902b4u,0x6f6e02b5u,0x686702b6u,0x10002b7u,0x80000038u,0x757402b9u,0x767502bau,0x747302bbu,0x444302bcu,0x626102bdu,0x6d6c02beu,0x6d6c02bfu,0x636202c0u,0x626102c1u,0x646302c2u,0x6c6b02c3u,0x560002c4u,0x80000039u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7473031au,0x6665031bu,0x7372031cu,0x4544031du,0x6261031eu,0x7574031fu,0x62610320u,0x1000321u,0x8000003au,0x67660323u,0x62610324u,0x64630325u,0x66650326u,0x1000327u,0x8000003bu,0x62610329u,0x6f6e032au,0x7473032bu,0x6766032cu,0x706f032du,0x7372032eu,0x6e6d032fu,0x1000330u,0x8000003cu,0x6a690334u,0x0u,0x100033fu,0x75740335u,0x45440336u,0x6a690337u,0x74730338u,0x75740339u,0x6261033au,0x6f6e033bu,0x6463033cu,0x6665033du,0x100033eu,0x8000003du,0x8000003eu,0x6d6c034fu,0x0u,0x0u,0x0u,0x737203aau,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c0403u,0x76750350u,0x66650351u,0x53000352u,0x8000003fu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626103a5u,0x6f6e03a6u,0x686703a7u,0x666503a8u,0x10003a9u,0x80000040u,0x757403abu,0x666503acu,0x797803adu,0x2f2e03aeu,0x756103afu,0x757403c3u,0x0u,0x706103d3u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f03e8u,0x0u,0x706f03eeu,0x0u,0x626103f6u,0x0u,0x626103fcu,0x757403c4u,0x737203c5u,0x6a6903c6u,0x636203c7u,0x767503c8u,0x757403c9u,0x666503cau,0x343003cbu,0x10003cfu,0x10003d0u,0x10003d1u,0x10003d2u,0x80000041u,0x80000042u,0x80000043u,0x80000044u,0x717003e2u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c03e4u,0x10003e3u,0x80000045u,0x706f03e5u,0x737203e6u,0x10003e7u,0x80000046u,0x737203e9u,0x6e6d03eau,0x626103ebu,0x6d6c03ecu,0x10003edu,0x80000047u,0x747303efu,0x6a6903f0u,0x757403f1u,0x6a6903f2u,0x706f03f3u,0x6f6e03f4u,0x10003f5u,0x80000048u,0x656403f7u,0x6a6903f8u,0x767503f9u,0x747303fau,0x10003fbu,0x80000049u,0x6f6e03fdu,0x686703feu,0x666503ffu,0x6f6e0400u,0x75740401u,0x1000402u,0x8000004au,0x76750404u,0x6e6d0405u,0x66650406u,0x1000407u,0x8000004bu,0x7372040cu,0x0u,0x0u,0x62610410u,0x6d6c040du,0x6564040eu,0x100040fu,0x8000004cu,0x71700411u,0x4e4d0412u,0x706f0413u,0x65640414u,0x66650415u,0x34310416u,0x1000419u,0x100041au,0x100041bu,0x8000004du,0x8000004eu,0x8000004fu};
+   static const uint32_t table[] = {0x756c0017u,0x62610075u,0x7061007fu,0x6a6100d7u,0x62610165u,0x70610172u,0x7365020cu,0x7a650225u,0x6f640248u,0x0u,0x0u,0x6a650335u,0x70610395u,0x666103aeu,0x767003b9u,0x736f03e0u,0x0u,0x66610440u,0x786804b6u,0x73690575u,0x716e061cu,0x7061062bu,0x736f0710u,0x716c0020u,0x6362004fu,0x0u,0x0u,0x0u,0x0u,0x7372005du,0x71700061u,0x75740066u,0x706f0025u,0x0u,0x0u,0x0u,0x69680038u,0x78770026u,0x4a490027u,0x6f6e0028u,0x77760029u,0x6261002au,0x6d6c002bu,0x6a69002cu,0x6564002du,0x4e4d002eu,0x6261002fu,0x75740030u,0x66650031u,0x73720032u,0x6a690033u,0x62610034u,0x6d6c0035u,0x74730036u,0x1000037u,0x80000000u,0x62610039u,0x4e43003au,0x76750045u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f004bu,0x75740046u,0x706f0047u,0x67660048u,0x67660049u,0x100004au,0x80000001u,0x6564004cu,0x6665004du,0x100004eu,0x80000002u,0x6a690050u,0x66650051u,0x6f6e0052u,0x75740053u,0x53520054u,0x62610055u,0x65640056u,0x6a690057u,0x62610058u,0x6f6e0059u,0x6463005au,0x6665005bu,0x100005cu,0x80000003u,0x6261005eu,0x7a79005fu,0x1000060u,0x80000004u,0x66650062u,0x64630063u,0x75740064u,0x1000065u,0x80000005u,0x73720067u,0x6a690068u,0x63620069u,0x7675006au,0x7574006bu,0x6665006cu,0x3430006du,0x1000071u,0x1000072u,0x1000073u,0x1000074u,0x80000006u,0x80000007u,0x80000008u,0x80000009u,0x64630076u,0x6c6b0077u,0x68670078u,0x73720079u,0x706f007au,0x7675007bu,0x6f6e007cu,0x6564007du,0x100007eu,0x8000000au,0x716d008eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610098u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c00d3u,0x66650092u,0x0u,0x0u,0x74730096u,0x73720093u,0x62610094u,0x1000095u,0x8000000bu,0x1000097u,0x8000000cu,0x6f6e0099u,0x6f6e009au,0x6665009bu,0x6d6c009cu,0x2f2e009du,0x7163009eu,0x706f00acu,0x666500b1u,0x0u,0x0u,0x0u,0x0u,0x6f6e00b6u,0x0u,0x0u,0x0u,0x0u,0x0u,0x636200c0u,0x737200c8u,0x6d6c00adu,0x706f00aeu,0x737200afu,0x10000b0u,0x8000000du,0x717000b2u,0x757400b3u,0x696800b4u,0x10000b5u,0x8000000eu,0x747300b7u,0x757400b8u,0x626100b9u,0x6f6e00bau,0x646300bbu,0x666500bcu,0x4a4900bdu,0x656400beu,0x10000bfu,0x8000000fu,0x6b6a00c1u,0x666500c2u,0x646300c3u,0x757400c4u,0x4a4900c5u,0x656400c6u,0x10000c7u,0x80000010u,0x6a6900c9u,0x6e6d00cau,0x6a6900cbu,0x757400ccu,0x6a6900cdu,0x777600ceu,0x666500cfu,0x4a4900d0u,0x656400d1u,0x10000d2u,0x80000011u,0x706f00d4u,0x737200d5u,0x10000d6u,0x80000012u,0x757400e0u,0x0u,0x0u,0x0u,0x6f6600e3u,0x0u,0x0u,0x0u,0x7372015du,0x626100e1u,0x10000e2u,0x80000013u,0x666500ecu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f00fdu,0x737200edu,0x737200eeu,0x666500efu,0x656400f0u,0x535200f1u,0x666500f2u,0x646300f3u,0x6d6c00f4u,0x626100f5u,0x6e6d00f6u,0x626100f7u,0x757400f8u,0x6a6900f9u,0x706f00fau,0x6f6e00fbu,0x10000fcu,0x80000014u,0x6a6900feu,0x747300ffu,0x66650100u,0x4a000101u,0x80000015u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f014bu,0x0u,0x0u,0x0u,0x0u,0x0u,0x75740153u,0x6d6c014cu,0x706f014du,0x7372014eu,0x5150014fu,0x69680150u,0x6a690151u,0x1000152u,0x80000016u,0x66650154u,0x73720155u,0x62610156u,0x75740157u,0x6a690158u,0x706f0159u,0x6f6e015au,0x7473015bu,0x100015cu,0x80000017u,0x6665015eu,0x6463015fu,0x75740160u,0x6a690161u,0x706f0162u,0x6f6e0163u,0x1000164u,0x80000018u,0x68670166u,0x66650167u,0x73720168u,0x43420169u,0x5756016au,0x4948016bu,0x4342016cu,0x7675016du,0x6a69016eu,0x6d6c016fu,0x65640170u,0x1000171u,0x80000019u,0x73720181u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x796c0183u,0x0u,0x0u,0x0u,0x0u,0x0u,0x777601d9u,0x1000182u,0x8000001au,0x75650190u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626101cdu,0x6f4f01a0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x666501cau,0x676601c0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626101c6u,0x676601c1u,0x747301c2u,0x666501c3u,0x757401c4u,0x10001c5u,0x8000001bu,0x6e6d01c7u,0x666501c8u,0x10001c9u,0x8000001cu,0x737201cbu,0x10001ccu,0x8000001du,0x757401ceu,0x6a6901cfu,0x706f01d0u,0x6f6e01d1u,0x515001d2u,0x706f01d3u,0x6a6901d4u,0x6f6e01d5u,0x757401d6u,0x747301d7u,0x10001d8u,0x8000001eu,0x7a6501dau,0x626101efu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x100020bu,0x756c01f0u,0x535201f9u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a690200u,0x626101fau,0x656401fbu,0x6a6901fcu,0x767501fdu,0x747301feu,0x10001ffu,0x8000001fu,0x706f0201u,0x6f6e0202u,0x47460203u,0x62610204u,0x6d6c0205u,0x6d6c0206u,0x706f0207u,0x67660208u,0x67660209u,0x100020au,0x80000020u,0x80000021u,0x706f021au,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0221u,0x6e6d021bu,0x6665021cu,0x7574021du,0x7372021eu,0x7a79021fu,0x1000220u,0x80000022u,0x76750222u,0x71700223u,0x1000224u,0x80000023u,0x6a69023au,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7473023fu,0x6867023bu,0x6968023cu,0x7574023du,0x100023eu,0x80000024u,0x75740240u,0x66650241u,0x73720242u,0x66650243u,0x74730244u,0x6a690245u,0x74730246u,0x1000247u,0x80000025u,0x1000253u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610254u,0x774102bbu,0x80000026u,0x68670255u,0x66650256u,0x54000257u,0x80000027u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f02abu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x666502b1u,0x6a6902b7u,0x737202acu,0x6e6d02adu,0x626102aeu,0x757402afu,0x10002b0u,0x80000028u,0x686702b2u,0x6a6902b3u,0x706f02b4u,0x6f6e02b5u,0x10002b6u,0x80000029u,0x7b7a02b8u,0x666502b9u,0x10002bau,0x8000002au,0x757402f1u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x676602fau,0x0u,0x0u,0x0u,0x0u,0x73720300u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x75740309u,0x6665030fu,0x0u,0x62610323u,0x757402f2u,0x737202f3u,0x6a6902f4u,0x636202f5u,0x767502f6u,0x757402f7u,0x666502f8u,0x10002f9u,0x8000002bu,0x676602fbu,0x747302fcu,0x666502fdu,0x757402feu,0x10002ffu,0x8000002cu,0x62610301u,0x6f6e0302u,0x74730303u,0x67660304u,0x706f0305u,0x73720306u,0x6e6d0307u,0x1000308u,0x8000002du,0x6261030au,0x6f6e030bu,0x6463030cu,0x6665030du,0x100030eu,0x8000002eu,0x73720310u,0x71700311u,0x76750312u,0x71700313u,0x6a690314u,0x6d6c0315u,0x6d6c0316u,0x62610317u,0x73720318u,0x7a790319u,0x4544031au,0x6a69031bu,0x7473031cu,0x7574031du,0x6261031eu,0x6f6e031fu,0x64630320u,0x66650321u,0x1000322u,0x8000002fu,0x6d6c0324u,0x6a690325u,0x65640326u,0x4e4d0327u,0x62610328u,0x75740329u,0x6665032au,0x7372032bu,0x6a69032cu,0x6261032du,0x6d6c032eu,0x4443032fu,0x706f0330u,0x6d6c0331u,0x706f0332u,0x73720333u,0x1000334u,0x80000030u,0x7776033au,0x0u,0x0u,0x0u,0x68670391u,0x6665033bu,0x6d6c033cu,0x504f033du,0x6766033eu,0x4544033fu,0x66650340u,0x75740341u,0x62610342u,0x6a690343u,0x6d6c0344u,0x43000345u,0x80000031u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x74730388u,0x6a69038du,0x7a790389u,0x6f6e038au,0x6463038bu,0x100038cu,0x80000032u,0x6261038eu,0x7473038fu,0x1000390u,0x80000033u,0x69680392u,0x75740393u,0x1000394u,0x80000034u,0x757403a4u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x656403abu,0x666503a5u,0x737203a6u,0x6a6903a7u,0x626103a8u,0x6d6c03a9u,0x10003aau,0x80000035u,0x666503acu,0x10003adu,0x80000036u,0x6e6d03b3u,0x0u,0x0u,0x0u,0x626103b6u,0x666503b4u,0x10003b5u,0x80000037u,0x737203b7u,0x10003b8u,0x80000038u,0x626103bfu,0x0u,0x6a6903c5u,0x0u,0x0u,0x757403cau,0x646303c0u,0x6a6903c1u,0x757403c2u,0x7a7903c3u,0x10003c4u,0x80000039u,0x686703c6u,0x6a6903c7u,0x6f6e03c8u,0x10003c9u,0x8000003au,0x554f03cbu,0x676603d1u,0x0u,0x0u,0x0u,0x0u,0x737203d7u,0x676603d2u,0x747303d3u,0x666503d4u,0x757403d5u,0x10003d6u,0x8000003bu,0x626103d8u,0x6f6e03d9u,0x747303dau,0x676603dbu,0x706f03dcu,0x737203ddu,0x6e6d03deu,0x10003dfu,0x8000003cu,0x747303e4u,0x0u,0x0u,0x706903ebu,0x6a6903e5u,0x757403e6u,0x6a6903e7u,0x706f03e8u,0x6f6e03e9u,0x10003eau,0x8000003du,0x6e6d03f2u,0x0u,0x0u,0x0u,0x0u,0x0u,0x79780436u,0x6a6903f3u,0x757403f4u,0x6a6903f5u,0x777603f6u,0x666503f7u,0x2f2e03f8u,0x736103f9u,0x7574040bu,0x0u,0x706f041bu,0x0u,0x0u,0x0u,0x0u,0x0u,0x6f640420u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610430u,0x7574040cu,0x7372040du,0x6a69040eu,0x6362040fu,0x76750410u,0x75740411u,0x66650412u,0x34300413u,0x1000417u,0x1000418u,0x1000419u,0x100041au,0x8000003eu,0x8000003fu,0x80000040u,0x80000041u,0x6d6c041cu,0x706f041du,0x7372041eu,0x100041fu,0x80000042u,0x100042bu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6564042cu,0x80000043u,0x6665042du,0x7978042eu,0x100042fu,0x80000044u,0x65640431u,0x6a690432u,0x76750433u,0x74730434u,0x1000435u,0x80000045u,0x7a790437u,0x51500438u,0x73720439u,0x6665043au,0x7776043bu,0x6a69043cu,0x6665043du,0x7877043eu,0x100043fu,0x80000046u,0x65640445u,0x0u,0x0u,0x0u,0x716e044au,0x6a690446u,0x76750447u,0x74730448u,0x1000449u,0x80000047u,0x6564044du,0x0u,0x73720453u,0x6665044eu,0x7372044fu,0x66650450u,0x73720451u,0x1000452u,0x80000048u,0x706f0454u,0x6b6a0455u,0x66650456u,0x64630457u,0x75740458u,0x6a690459u,0x706f045au,0x6f6e045bu,0x5300045cu,0x80000049u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x666504afu,0x676604b0u,0x737204b1u,0x666504b2u,0x747304b3u,0x696804b4u,0x10004b5u,0x8000004au,0x626104c6u,0x7b7a04d0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626104d3u,0x0u,0x0u,0x0u,0x666104d9u,0x7372054fu,0x0u,0x6a690555u,0x656404c7u,0x6a6904c8u,0x6f6e04c9u,0x686704cau,0x535204cbu,0x626104ccu,0x757404cdu,0x666504ceu,0x10004cfu,0x8000004bu,0x666504d1u,0x10004d2u,0x8000004cu,0x646304d4u,0x6a6904d5u,0x6f6e04d6u,0x686704d7u,0x10004d8u,0x8000004du,0x757404deu,0x0u,0x0u,0x0u,0x73720547u,0x767504dfu,0x747304e0u,0x444304e1u,0x626104e2u,0x6d6c04e3u,0x6d6c04e4u,0x636204e5u,0x626104e6u,0x646304e7u,0x6c6b04e8u,0x560004e9u,0x8000004eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7473053fu,0x66650540u,0x73720541u,0x45440542u,0x62610543u,0x75740544u,0x62610545u,0x1000546u,0x8000004fu,0x66650548u,0x706f0549u,0x4e4d054au,0x706f054bu,0x6564054cu,0x6665054du,0x100054eu,0x80000050u,0x67660550u,0x62610551u,0x64630552u,0x66650553u,0x1000554u,0x80000051u,0x75740556u,0x64630557u,0x69680558u,0x54440559u,0x6a690569u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a690571u,0x7473056au,0x7574056bu,0x6261056cu,0x6f6e056du,0x6463056eu,0x6665056fu,0x1000570u,0x80000052u,0x7b7a0572u,0x66650573u,0x1000574u,0x80000053u,0x6e6c057fu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610614u,0x66650581u,0x6665060cu,0x54430582u,0x62610593u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a690608u,0x6d630594u,0x6968059eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c05a5u,0x6665059fu,0x545305a0u,0x6a6905a1u,0x7b7a05a2u,0x666505a3u,0x10005a4u,0x80000054u,0x636205a6u,0x626105a7u,0x646305a8u,0x6c6b05a9u,0x560005aau,0x80000055u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x74730600u,0x66650601u,0x73720602u,0x45440603u,0x62610604u,0x75740605u,0x62610606u,0x1000607u,0x80000056u,0x7b7a0609u,0x6665060au,0x100060bu,0x80000057u,0x4342060du,0x7675060eu,0x6564060fu,0x68670610u,0x66650611u,0x75740612u,0x1000613u,0x80000058u,0x6f6e0615u,0x74730616u,0x67660617u,0x706f0618u,0x73720619u,0x6e6d061au,0x100061bu,0x80000059u,0x6a69061fu,0x0u,0x100062au,0x75740620u,0x45440621u,0x6a690622u,0x74730623u,0x75740624u,0x62610625u,0x6f6e0626u,0x64630627u,0x66650628u,0x1000629u,0x8000005au,0x8000005bu,0x6d6c063au,0x0u,0x0u,0x0u,0x73720695u,0x0u,0x0u,0x0u,0x666506eeu,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c070bu,0x7675063bu,0x6665063cu,0x5300063du,0x8000005cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610690u,0x6f6e0691u,0x68670692u,0x66650693u,0x1000694u,0x8000005du,0x75740696u,0x66650697u,0x79780698u,0x2f2e0699u,0x7561069au,0x757406aeu,0x0u,0x706106beu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f06d3u,0x0u,0x706f06d9u,0x0u,0x626106e1u,0x0u,0x626106e7u,0x757406afu,0x737206b0u,0x6a6906b1u,0x636206b2u,0x767506b3u,0x757406b4u,0x666506b5u,0x343006b6u,0x10006bau,0x10006bbu,0x10006bcu,0x10006bdu,0x8000005eu,0x8000005fu,0x80000060u,0x80000061u,0x717006cdu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c06cfu,0x10006ceu,0x80000062u,0x706f06d0u,0x737206d1u,0x10006d2u,0x80000063u,0x737206d4u,0x6e6d06d5u,0x626106d6u,0x6d6c06d7u,0x10006d8u,0x80000064u,0x747306dau,0x6a6906dbu,0x757406dcu,0x6a6906ddu,0x706f06deu,0x6f6e06dfu,0x10006e0u,0x80000065u,0x656406e2u,0x6a6906e3u,0x767506e4u,0x747306e5u,0x10006e6u,0x80000066u,0x6f6e06e8u,0x686706e9u,0x666506eau,0x6f6e06ebu,0x757406ecu,0x10006edu,0x80000067u,0x787706efu,0x504306f0u,0x706f06fdu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x67660704u,0x6d6c06feu,0x767506ffu,0x6e6d0700u,0x6f6e0701u,0x74730702u,0x1000703u,0x80000068u,0x67660705u,0x74730706u,0x66650707u,0x75740708u,0x74730709u,0x100070au,0x80000069u,0x7675070cu,0x6e6d070du,0x6665070eu,0x100070fu,0x8000006au,0x73720714u,0x0u,0x0u,0x62610718u,0x6d6c0715u,0x65640716u,0x1000717u,0x8000006bu,0x71700719u,0x4e4d071au,0x706f071bu,0x6564071cu,0x6665071du,0x3431071eu,0x1000721u,0x1000722u,0x1000723u,0x8000006cu,0x8000006du,0x8000006eu};
    uint32_t cur = 0x78610000u;
    for(int i = 0;cur!=0;++i) {
       uint32_t idx = cur&0xFFFFu;
@@ -110,16 +110,26 @@ const char ** query_object_types(ANARIDataType type) {
          static const char *ANARI_RENDERER_subtypes[] = {"default", 0};
          return ANARI_RENDERER_subtypes;
       }
-      case ANARI_INSTANCE:
+      case ANARI_SAMPLER:
       {
-         static const char *ANARI_INSTANCE_subtypes[] = {"transform", 0};
-         return ANARI_INSTANCE_subtypes;
+         static const char *ANARI_SAMPLER_subtypes[] = {"image2D", "image1D", "image3D", "primitive", "transform", 0};
+         return ANARI_SAMPLER_subtypes;
       }
       case ANARI_CAMERA:
       {
-         static const char *ANARI_CAMERA_subtypes[] = {"orthographic", "perspective", 0};
+         static const char *ANARI_CAMERA_subtypes[] = {"perspective", "orthographic", 0};
          return ANARI_CAMERA_subtypes;
       }
+      case ANARI_INSTANCE:
+      {
+         static const char *ANARI_INSTANCE_subtypes[] = {"lod", "transform", 0};
+         return ANARI_INSTANCE_subtypes;
+      }
+      case ANARI_SPATIAL_FIELD:
+      {
+         static const char *ANARI_SPATIAL_FIELD_subtypes[] = {"structuredRegular", 0};
+         return ANARI_SPATIAL_FIELD_subtypes;
+      }
       case ANARI_VOLUME:
       {
          static const char *ANARI_VOLUME_subtypes[] = {"", "transferFunction1D", 0};
@@ -135,16 +145,6 @@ const char ** query_object_types(ANARIDataType type) {
          static const char *ANARI_MATERIAL_subtypes[] = {"matte", 0};
          return ANARI_MATERIAL_subtypes;
       }
-      case ANARI_SAMPLER:
-      {
-         static const char *ANARI_SAMPLER_subtypes[] = {"image1D", "image2D", "image3D", "primitive", "transform", 0};
-         return ANARI_SAMPLER_subtypes;
-      }
-      case ANARI_SPATIAL_FIELD:
-      {
-         static const char *ANARI_SPATIAL_FIELD_subtypes[] = {"structuredRegular", 0};
-         return ANARI_SPATIAL_FIELD_subtypes;
-      }
       default:
       {
          static const char *none_subtypes[] = {0};
@@ -200,6 +200,54 @@ static const void * ANARI_DEVICE_invalidMaterialColor_info(ANARIDataType paramTy
       default: return nullptr;
    }
 }
+static const void * ANARI_DEVICE_eagerBVHBuild_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "build the BVH of a group on a background thread as soon as it or one of its geometries is committed";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_DEVICE_deferredReclamation_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "delete released objects on a background thread, app memory deleters then run on that thread";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
 static const void * ANARI_DEVICE_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
@@ -255,13 +303,17 @@ static const void * ANARI_DEVICE_param_info(const char *paramName, ANARIDataType
    switch(param_hash(paramName)) {
       case 0:
          return ANARI_DEVICE_allowInvalidMaterials_info(paramType, infoName, infoType);
-      case 34:
+      case 48:
          return ANARI_DEVICE_invalidMaterialColor_info(paramType, infoName, infoType);
-      case 38:
+      case 25:
+         return ANARI_DEVICE_eagerBVHBuild_info(paramType, infoName, infoType);
+      case 20:
+         return ANARI_DEVICE_deferredReclamation_info(paramType, infoName, infoType);
+      case 55:
          return ANARI_DEVICE_name_info(paramType, infoName, infoType);
-      case 57:
+      case 78:
          return ANARI_DEVICE_statusCallback_info(paramType, infoName, infoType);
-      case 58:
+      case 79:
          return ANARI_DEVICE_statusCallbackUserData_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -369,15 +421,15 @@ static const void * ANARI_RENDERER_default_param_info(const char *paramName, ANA
          return ANARI_RENDERER_default_background_info(paramType, infoName, infoType);
       case 3:
          return ANARI_RENDERER_default_ambientRadiance_info(paramType, infoName, infoType);
-      case 37:
+      case 54:
          return ANARI_RENDERER_default_mode_info(paramType, infoName, infoType);
-      case 38:
+      case 55:
          return ANARI_RENDERER_default_name_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_ARRAY1D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_tileCallback_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -388,21 +440,13 @@ static const void * ANARI_ARRAY1D_name_info(ANARIDataType paramType, int infoNam
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "HelideTileReadCallback invoked to read texture tiles on demand";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_ARRAY1D_name_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_ARRAY2D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_tileCallbackUserData_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -413,21 +457,13 @@ static const void * ANARI_ARRAY2D_name_info(ANARIDataType paramType, int infoNam
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "user data passed to tileCallback";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY2D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_ARRAY2D_name_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_ARRAY3D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_filename_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -438,21 +474,13 @@ static const void * ANARI_ARRAY3D_name_info(ANARIDataType paramType, int infoNam
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "raw image file read (memory mapped) on demand instead of image";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY3D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_ARRAY3D_name_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_FRAME_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_fileOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -461,83 +489,111 @@ static const void * ANARI_FRAME_name_info(ANARIDataType paramType, int infoName,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_UINT64 && infoType == ANARI_UINT64) {
+            static const uint64_t default_value[1] = {UINT64_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "byte offset of the first texel in filename";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_world_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_imageSize_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "world to be rendererd";
+            static const char *description = "texel dimensions of an image read from tileCallback or filename";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_renderer_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_imageFormat_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "renderer which renders the frame";
+            static const char *description = "texel type of an image read from tileCallback or filename";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_camera_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_tileSize_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_UINT32 && infoType == ANARI_UINT32) {
+            static const uint32_t default_value[1] = {UINT32_C(64)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_UINT32 && infoType == ANARI_UINT32) {
+            static const uint32_t default_value[1] = {UINT32_C(1)};
+            return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "camera used to render the world";
+            static const char *description = "width and height of texture tiles";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_size_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_tileCacheSize_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_UINT64 && infoType == ANARI_UINT64) {
+            static const uint64_t default_value[1] = {UINT64_C(67108864)};
+            return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "size of the frame in pixels (width, height)";
+            static const char *description = "maximum bytes of resident texture tiles, tiles not sampled recently are evicted first";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_channel_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -548,44 +604,53 @@ static const void * ANARI_FRAME_channel_color_info(ANARIDataType paramType, int
          }
       case 4: // description
          {
-            static const char *description = "enables mapping the color channel as the type specified";
+            static const char *description = "optional object name";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8_VEC4, ANARI_UFIXED8_RGBA_SRGB, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 15;
+            return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_channel_depth_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_image_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "enables mapping the color channel as the type specified";
+            static const char *description = "array backing the sampler";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 15;
+            return &value;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_channel_primitiveId_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_inAttribute_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -594,30 +659,37 @@ static const void * ANARI_FRAME_channel_primitiveId_info(ANARIDataType paramType
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "attribute0";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "enables mapping the primitiveId channel as the type specified";
+            static const char *description = "input surface attribute (texture coordinate)";
             return description;
          }
       case 6: // value
-         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UNKNOWN};
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_FRAME_CHANNEL_PRIMITIVE_ID";
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 4;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_channel_objectId_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -626,30 +698,37 @@ static const void * ANARI_FRAME_channel_objectId_info(ANARIDataType paramType, i
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "nearest";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "enables mapping the objectId channel as the type specified";
+            static const char *description = "filter mode";
             return description;
          }
       case 6: // value
-         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UNKNOWN};
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"nearest", "linear", nullptr};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_FRAME_CHANNEL_OBJECT_ID";
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_channel_instanceId_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_wrapMode1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -658,56 +737,926 @@ static const void * ANARI_FRAME_channel_instanceId_info(ANARIDataType paramType,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "clampToEdge";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "enables mapping the instanceId channel as the type specified";
+            static const char *description = "wrap mode for the 1st dimension";
             return description;
          }
       case 6: // value
-         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UNKNOWN};
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_FRAME_CHANNEL_INSTANCE_ID";
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_FRAME_name_info(paramType, infoName, infoType);
-      case 76:
-         return ANARI_FRAME_world_info(paramType, infoName, infoType);
-      case 54:
-         return ANARI_FRAME_renderer_info(paramType, infoName, infoType);
-      case 11:
-         return ANARI_FRAME_camera_info(paramType, infoName, infoType);
-      case 55:
-         return ANARI_FRAME_size_info(paramType, infoName, infoType);
-      case 13:
-         return ANARI_FRAME_channel_color_info(paramType, infoName, infoType);
-      case 14:
-         return ANARI_FRAME_channel_depth_info(paramType, infoName, infoType);
-      case 17:
-         return ANARI_FRAME_channel_primitiveId_info(paramType, infoName, infoType);
-      case 16:
-         return ANARI_FRAME_channel_objectId_info(paramType, infoName, infoType);
-      case 15:
-         return ANARI_FRAME_channel_instanceId_info(paramType, infoName, infoType);
+static const void * ANARI_SAMPLER_image2D_wrapMode2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "clampToEdge";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "wrap mode for the 2nd dimension";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 15;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image2D_inTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "transform applied to the input attribute before sampling";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 15;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image2D_inOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "offset added to output inTransform result";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 15;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image2D_outTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "transform applied to the sampled values";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 15;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image2D_outOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "offset added to output outTransform result";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 15;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image2D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 85:
+         return ANARI_SAMPLER_image2D_tileCallback_info(paramType, infoName, infoType);
+      case 86:
+         return ANARI_SAMPLER_image2D_tileCallbackUserData_info(paramType, infoName, infoType);
+      case 28:
+         return ANARI_SAMPLER_image2D_filename_info(paramType, infoName, infoType);
+      case 27:
+         return ANARI_SAMPLER_image2D_fileOffset_info(paramType, infoName, infoType);
+      case 42:
+         return ANARI_SAMPLER_image2D_imageSize_info(paramType, infoName, infoType);
+      case 40:
+         return ANARI_SAMPLER_image2D_imageFormat_info(paramType, infoName, infoType);
+      case 87:
+         return ANARI_SAMPLER_image2D_tileSize_info(paramType, infoName, infoType);
+      case 84:
+         return ANARI_SAMPLER_image2D_tileCacheSize_info(paramType, infoName, infoType);
+      case 55:
+         return ANARI_SAMPLER_image2D_name_info(paramType, infoName, infoType);
+      case 39:
+         return ANARI_SAMPLER_image2D_image_info(paramType, infoName, infoType);
+      case 43:
+         return ANARI_SAMPLER_image2D_inAttribute_info(paramType, infoName, infoType);
+      case 29:
+         return ANARI_SAMPLER_image2D_filter_info(paramType, infoName, infoType);
+      case 108:
+         return ANARI_SAMPLER_image2D_wrapMode1_info(paramType, infoName, infoType);
+      case 109:
+         return ANARI_SAMPLER_image2D_wrapMode2_info(paramType, infoName, infoType);
+      case 45:
+         return ANARI_SAMPLER_image2D_inTransform_info(paramType, infoName, infoType);
+      case 44:
+         return ANARI_SAMPLER_image2D_inOffset_info(paramType, infoName, infoType);
+      case 60:
+         return ANARI_SAMPLER_image2D_outTransform_info(paramType, infoName, infoType);
+      case 59:
+         return ANARI_SAMPLER_image2D_outOffset_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_perspective_viewOffsets_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per-view eye offsets (in camera right/up units) rendered side by side in one frame";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC2, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_perspective_viewColumns_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "number of view columns in the frame when viewOffsets is set";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_perspective_stereoMode_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "none";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "stereo mode, all eyes are rendered in a single frame pass";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"none", "left", "right", "sideBySide", "topBottom", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_perspective_interpupillaryDistance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.063500f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "interpupillary distance for stereo rendering";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_perspective_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 2;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_perspective_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "point";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "camera position";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 2;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_perspective_direction_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, -1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "direction";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "main viewing direction";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 2;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_perspective_up_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 1.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "direction";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "camera up direction";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 2;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_perspective_imageRegion_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_BOX2 && infoType == ANARI_FLOAT32_BOX2) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 1.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "region mapped to the frame";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 2;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_perspective_fovy_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.047198f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertical field of view in radians";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 2;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_perspective_aspect_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "aspect ratio";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 2;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_perspective_near_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "near plane clip distance";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 2;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_perspective_far_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "far plane clip distance";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 2;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_perspective_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 105:
+         return ANARI_CAMERA_perspective_viewOffsets_info(paramType, infoName, infoType);
+      case 104:
+         return ANARI_CAMERA_perspective_viewColumns_info(paramType, infoName, infoType);
+      case 80:
+         return ANARI_CAMERA_perspective_stereoMode_info(paramType, infoName, infoType);
+      case 47:
+         return ANARI_CAMERA_perspective_interpupillaryDistance_info(paramType, infoName, infoType);
+      case 55:
+         return ANARI_CAMERA_perspective_name_info(paramType, infoName, infoType);
+      case 61:
+         return ANARI_CAMERA_perspective_position_info(paramType, infoName, infoType);
+      case 24:
+         return ANARI_CAMERA_perspective_direction_info(paramType, infoName, infoType);
+      case 91:
+         return ANARI_CAMERA_perspective_up_info(paramType, infoName, infoType);
+      case 41:
+         return ANARI_CAMERA_perspective_imageRegion_info(paramType, infoName, infoType);
+      case 33:
+         return ANARI_CAMERA_perspective_fovy_info(paramType, infoName, infoType);
+      case 5:
+         return ANARI_CAMERA_perspective_aspect_info(paramType, infoName, infoType);
+      case 56:
+         return ANARI_CAMERA_perspective_near_info(paramType, infoName, infoType);
+      case 26:
+         return ANARI_CAMERA_perspective_far_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_GROUP_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_orthographic_viewOffsets_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per-view eye offsets (in camera right/up units) rendered side by side in one frame";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC2, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_orthographic_viewColumns_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "number of view columns in the frame when viewOffsets is set";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_orthographic_stereoMode_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "none";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "stereo mode, all eyes are rendered in a single frame pass";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"none", "left", "right", "sideBySide", "topBottom", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_orthographic_interpupillaryDistance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.063500f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "interpupillary distance for stereo rendering";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_orthographic_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 1;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_orthographic_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "point";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "camera position";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 1;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_orthographic_direction_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, -1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "direction";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "main viewing direction";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 1;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_orthographic_up_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 1.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "direction";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "camera up direction";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 1;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_orthographic_imageRegion_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_BOX2 && infoType == ANARI_FLOAT32_BOX2) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 1.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "region mapped to the frame";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 1;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_orthographic_aspect_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -716,15 +1665,30 @@ static const void * ANARI_GROUP_name_info(ANARIDataType paramType, int infoName,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "aspect ratio";
             return description;
          }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 1;
+            return &value;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_surface_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_orthographic_height_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -733,22 +1697,30 @@ static const void * ANARI_GROUP_surface_info(ANARIDataType paramType, int infoNa
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "array of surface objects";
+            static const char *description = "height of image plane";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_SURFACE, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 1;
+            return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_volume_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_orthographic_near_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -759,20 +1731,21 @@ static const void * ANARI_GROUP_volume_info(ANARIDataType paramType, int infoNam
          }
       case 4: // description
          {
-            static const char *description = "array of volume objects";
+            static const char *description = "near plane clip distance";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_VOLUME, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 1;
+            return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_light_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_orthographic_far_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -783,51 +1756,77 @@ static const void * ANARI_GROUP_light_info(ANARIDataType paramType, int infoName
          }
       case 4: // description
          {
-            static const char *description = "array of light objects";
+            static const char *description = "far plane clip distance";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 1;
+            return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_orthographic_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_GROUP_name_info(paramType, infoName, infoType);
-      case 59:
-         return ANARI_GROUP_surface_info(paramType, infoName, infoType);
-      case 75:
-         return ANARI_GROUP_volume_info(paramType, infoName, infoType);
-      case 35:
-         return ANARI_GROUP_light_info(paramType, infoName, infoType);
+      case 105:
+         return ANARI_CAMERA_orthographic_viewOffsets_info(paramType, infoName, infoType);
+      case 104:
+         return ANARI_CAMERA_orthographic_viewColumns_info(paramType, infoName, infoType);
+      case 80:
+         return ANARI_CAMERA_orthographic_stereoMode_info(paramType, infoName, infoType);
+      case 47:
+         return ANARI_CAMERA_orthographic_interpupillaryDistance_info(paramType, infoName, infoType);
+      case 55:
+         return ANARI_CAMERA_orthographic_name_info(paramType, infoName, infoType);
+      case 61:
+         return ANARI_CAMERA_orthographic_position_info(paramType, infoName, infoType);
+      case 24:
+         return ANARI_CAMERA_orthographic_direction_info(paramType, infoName, infoType);
+      case 91:
+         return ANARI_CAMERA_orthographic_up_info(paramType, infoName, infoType);
+      case 41:
+         return ANARI_CAMERA_orthographic_imageRegion_info(paramType, infoName, infoType);
+      case 5:
+         return ANARI_CAMERA_orthographic_aspect_info(paramType, infoName, infoType);
+      case 36:
+         return ANARI_CAMERA_orthographic_height_info(paramType, infoName, infoType);
+      case 56:
+         return ANARI_CAMERA_orthographic_near_info(paramType, infoName, infoType);
+      case 26:
+         return ANARI_CAMERA_orthographic_far_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_WORLD_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_lod_group_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "groups for each level of detail, ordered from finest to coarsest";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_GROUP, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_WORLD_instance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_lod_transform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -836,22 +1835,22 @@ static const void * ANARI_WORLD_instance_info(ANARIDataType paramType, int infoN
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "array of instance objects in the world";
+            static const char *description = "transform applied to all levels";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_INSTANCE, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_WORLD_surface_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_lod_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -862,20 +1861,13 @@ static const void * ANARI_WORLD_surface_info(ANARIDataType paramType, int infoNa
          }
       case 4: // description
          {
-            static const char *description = "array of non-instanced surface objects in the world";
+            static const char *description = "optional user ID, for ANARI_FRAME channel instanceId";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_SURFACE, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_WORLD_volume_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_lod_switchDistance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -886,12 +1878,12 @@ static const void * ANARI_WORLD_volume_info(ANARIDataType paramType, int infoNam
          }
       case 4: // description
          {
-            static const char *description = "array of non-instanced volume objects in the world";
+            static const char *description = "ascending camera distances at which level i switches to level i + 1";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
@@ -899,7 +1891,7 @@ static const void * ANARI_WORLD_volume_info(ANARIDataType paramType, int infoNam
       default: return nullptr;
    }
 }
-static const void * ANARI_WORLD_light_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_lod_switchSize_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -910,12 +1902,12 @@ static const void * ANARI_WORLD_light_info(ANARIDataType paramType, int infoName
          }
       case 4: // description
          {
-            static const char *description = "array of non-instanced light objects in the world";
+            static const char *description = "descending projected sizes (bounds diameter over distance) below which level i switches to level i + 1";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
@@ -923,23 +1915,7 @@ static const void * ANARI_WORLD_light_info(ANARIDataType paramType, int infoName
       default: return nullptr;
    }
 }
-static const void * ANARI_WORLD_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_WORLD_name_info(paramType, infoName, infoType);
-      case 33:
-         return ANARI_WORLD_instance_info(paramType, infoName, infoType);
-      case 59:
-         return ANARI_WORLD_surface_info(paramType, infoName, infoType);
-      case 75:
-         return ANARI_WORLD_volume_info(paramType, infoName, infoType);
-      case 35:
-         return ANARI_WORLD_light_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_SURFACE_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_lod_hysteresis_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -948,49 +1924,64 @@ static const void * ANARI_SURFACE_name_info(ANARIDataType paramType, int infoNam
          } else {
             return nullptr;
          }
-      case 4: // description
-         {
-            static const char *description = "optional object name";
-            return description;
-         }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_SURFACE_geometry_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   (void)paramType;
-   switch(infoName) {
-      case 0: // required
-         if(infoType == ANARI_BOOL) {
-            return &anari_true;
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.100000f};
+            return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "geometry object defining the surface geometry";
+            static const char *description = "relative band around each threshold inside which the current level is kept";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SURFACE_material_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_lod_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 35:
+         return ANARI_INSTANCE_lod_group_info(paramType, infoName, infoType);
+      case 89:
+         return ANARI_INSTANCE_lod_transform_info(paramType, infoName, infoType);
+      case 38:
+         return ANARI_INSTANCE_lod_id_info(paramType, infoName, infoType);
+      case 82:
+         return ANARI_INSTANCE_lod_switchDistance_info(paramType, infoName, infoType);
+      case 83:
+         return ANARI_INSTANCE_lod_switchSize_info(paramType, infoName, infoType);
+      case 37:
+         return ANARI_INSTANCE_lod_hysteresis_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_FRAME_reprojection_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "material object defining the surface appearance";
+            static const char *description = "reuse the previous frame for pixels still visible after a camera-only change";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SURFACE_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_reprojectionRefresh_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -999,37 +1990,22 @@ static const void * ANARI_SURFACE_id_info(ANARIDataType paramType, int infoName,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "user id for objectId channel";
+            static const char *description = "fraction of reprojected pixels re-traced every frame";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_FRAME_CHANNEL_OBJECT_ID";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_SURFACE_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_SURFACE_name_info(paramType, infoName, infoType);
-      case 24:
-         return ANARI_SURFACE_geometry_info(paramType, infoName, infoType);
-      case 36:
-         return ANARI_SURFACE_material_info(paramType, infoName, infoType);
-      case 27:
-         return ANARI_SURFACE_id_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_INSTANCE_transform_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_fixationPoints_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1040,21 +2016,20 @@ static const void * ANARI_INSTANCE_transform_name_info(ANARIDataType paramType,
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "fixation points in normalized frame coordinates, shading rate drops away from them";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_INSTANCE_TRANSFORM";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
-            return &value;
-         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC2, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_INSTANCE_transform_transform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_fovealRadius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1064,54 +2039,45 @@ static const void * ANARI_INSTANCE_transform_transform_info(ANARIDataType paramT
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
-            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.200000f};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "transform applied to objects in the instance";
+            static const char *description = "radius around fixation points traced at full rate, in units of the frame height";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_INSTANCE_TRANSFORM";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_INSTANCE_transform_group_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_foveationFalloff_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.200000f};
+            return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "group object being instanced";
+            static const char *description = "width of the quarter rate ring outside the foveal radius, further out is traced at 1/16 rate";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_INSTANCE_TRANSFORM";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_INSTANCE_transform_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_shadingRate_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1122,35 +2088,20 @@ static const void * ANARI_INSTANCE_transform_id_info(ANARIDataType paramType, in
          }
       case 4: // description
          {
-            static const char *description = "user id for instanceId channel";
+            static const char *description = "shading rate image stretched over the frame: 1, 2 or 4 pixels square per traced ray";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_FRAME_CHANNEL_INSTANCE_ID";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
-            return &value;
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT8, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_INSTANCE_transform_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_INSTANCE_transform_name_info(paramType, infoName, infoType);
-      case 60:
-         return ANARI_INSTANCE_transform_transform_info(paramType, infoName, infoType);
-      case 25:
-         return ANARI_INSTANCE_transform_group_info(paramType, infoName, infoType);
-      case 27:
-         return ANARI_INSTANCE_transform_id_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_CAMERA_orthographic_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_denoise_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1159,23 +2110,22 @@ static const void * ANARI_CAMERA_orthographic_name_info(ANARIDataType paramType,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "filter color with an edge-aware denoiser before it is written";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_denoiseIterations_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1185,35 +2135,35 @@ static const void * ANARI_CAMERA_orthographic_position_info(ANARIDataType paramT
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
+         if(paramType == ANARI_UINT32 && infoType == ANARI_UINT32) {
+            static const uint32_t default_value[1] = {UINT32_C(4)};
             return default_value;
          } else {
             return nullptr;
          }
-      case 11: // use
-         if(infoType == ANARI_STRING) {
-            return "point";
+      case 2: // minimum
+         if(paramType == ANARI_UINT32 && infoType == ANARI_UINT32) {
+            static const uint32_t default_value[1] = {UINT32_C(1)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 3: // maximum
+         if(paramType == ANARI_UINT32 && infoType == ANARI_UINT32) {
+            static const uint32_t default_value[1] = {UINT32_C(8)};
+            return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "camera position";
+            static const char *description = "number of a-trous filter passes, each doubling the filter footprint";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_direction_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_denoiseColorPhi_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1223,35 +2173,21 @@ static const void * ANARI_CAMERA_orthographic_direction_info(ANARIDataType param
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {0.000000f, 0.000000f, -1.000000f};
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.500000f};
             return default_value;
          } else {
             return nullptr;
          }
-      case 11: // use
-         if(infoType == ANARI_STRING) {
-            return "direction";
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "main viewing direction";
+            static const char *description = "how different two colors may be and still be blended";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_up_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_proxyPreview_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1261,35 +2197,21 @@ static const void * ANARI_CAMERA_orthographic_up_info(ANARIDataType paramType, i
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {0.000000f, 1.000000f, 0.000000f};
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
             return default_value;
          } else {
             return nullptr;
          }
-      case 11: // use
-         if(infoType == ANARI_STRING) {
-            return "direction";
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "camera up direction";
+            static const char *description = "render bounding boxes while BVHs build in the background";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_imageRegion_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_timeBudget_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1299,29 +2221,21 @@ static const void * ANARI_CAMERA_orthographic_imageRegion_info(ANARIDataType par
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_BOX2 && infoType == ANARI_FLOAT32_BOX2) {
-            static const float default_value[4] = {0.000000f, 0.000000f, 1.000000f, 1.000000f};
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "region mapped to the frame";
+            static const char *description = "milliseconds to spend on each frame, 0 renders frames in full; reprojection is not used and denoising is included in the budget";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_aspect_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1330,136 +2244,83 @@ static const void * ANARI_CAMERA_orthographic_aspect_info(ANARIDataType paramTyp
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
-            static const float default_value[1] = {1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "aspect ratio";
+            static const char *description = "optional object name";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_height_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_world_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
-            static const float default_value[1] = {1.000000f};
-            return default_value;
+      case 4: // description
+         {
+            static const char *description = "world to be rendererd";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_FRAME_renderer_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "height of image plane";
+            static const char *description = "renderer which renders the frame";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_near_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_camera_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "near plane clip distance";
+            static const char *description = "camera used to render the world";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_far_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_size_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "far plane clip distance";
+            static const char *description = "size of the frame in pixels (width, height)";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_CAMERA_orthographic_name_info(paramType, infoName, infoType);
-      case 44:
-         return ANARI_CAMERA_orthographic_position_info(paramType, infoName, infoType);
-      case 20:
-         return ANARI_CAMERA_orthographic_direction_info(paramType, infoName, infoType);
-      case 62:
-         return ANARI_CAMERA_orthographic_up_info(paramType, infoName, infoType);
-      case 29:
-         return ANARI_CAMERA_orthographic_imageRegion_info(paramType, infoName, infoType);
-      case 5:
-         return ANARI_CAMERA_orthographic_aspect_info(paramType, infoName, infoType);
-      case 26:
-         return ANARI_CAMERA_orthographic_height_info(paramType, infoName, infoType);
-      case 39:
-         return ANARI_CAMERA_orthographic_near_info(paramType, infoName, infoType);
-      case 21:
-         return ANARI_CAMERA_orthographic_far_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_CAMERA_perspective_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_channel_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1470,21 +2331,20 @@ static const void * ANARI_CAMERA_perspective_name_info(ANARIDataType paramType,
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "enables mapping the color channel as the type specified";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
-            return &value;
+      case 6: // value
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8_VEC4, ANARI_UFIXED8_RGBA_SRGB, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_channel_depth_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1493,36 +2353,22 @@ static const void * ANARI_CAMERA_perspective_position_info(ANARIDataType paramTy
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
-      case 11: // use
-         if(infoType == ANARI_STRING) {
-            return "point";
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "camera position";
+            static const char *description = "enables mapping the color channel as the type specified";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
-            return &value;
+      case 6: // value
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_direction_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_channel_primitiveId_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1531,36 +2377,30 @@ static const void * ANARI_CAMERA_perspective_direction_info(ANARIDataType paramT
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {0.000000f, 0.000000f, -1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
-      case 11: // use
-         if(infoType == ANARI_STRING) {
-            return "direction";
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "main viewing direction";
+            static const char *description = "enables mapping the primitiveId channel as the type specified";
             return description;
          }
+      case 6: // value
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            static const char *extension = "KHR_FRAME_CHANNEL_PRIMITIVE_ID";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_up_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_channel_objectId_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1569,36 +2409,30 @@ static const void * ANARI_CAMERA_perspective_up_info(ANARIDataType paramType, in
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {0.000000f, 1.000000f, 0.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
-      case 11: // use
-         if(infoType == ANARI_STRING) {
-            return "direction";
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "camera up direction";
+            static const char *description = "enables mapping the objectId channel as the type specified";
             return description;
          }
+      case 6: // value
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            static const char *extension = "KHR_FRAME_CHANNEL_OBJECT_ID";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_imageRegion_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_channel_instanceId_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1607,30 +2441,78 @@ static const void * ANARI_CAMERA_perspective_imageRegion_info(ANARIDataType para
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_BOX2 && infoType == ANARI_FLOAT32_BOX2) {
-            static const float default_value[4] = {0.000000f, 0.000000f, 1.000000f, 1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "region mapped to the frame";
+            static const char *description = "enables mapping the instanceId channel as the type specified";
             return description;
          }
+      case 6: // value
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            static const char *extension = "KHR_FRAME_CHANNEL_INSTANCE_ID";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_fovy_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 73:
+         return ANARI_FRAME_reprojection_info(paramType, infoName, infoType);
+      case 74:
+         return ANARI_FRAME_reprojectionRefresh_info(paramType, infoName, infoType);
+      case 30:
+         return ANARI_FRAME_fixationPoints_info(paramType, infoName, infoType);
+      case 31:
+         return ANARI_FRAME_fovealRadius_info(paramType, infoName, infoType);
+      case 32:
+         return ANARI_FRAME_foveationFalloff_info(paramType, infoName, infoType);
+      case 75:
+         return ANARI_FRAME_shadingRate_info(paramType, infoName, infoType);
+      case 21:
+         return ANARI_FRAME_denoise_info(paramType, infoName, infoType);
+      case 23:
+         return ANARI_FRAME_denoiseIterations_info(paramType, infoName, infoType);
+      case 22:
+         return ANARI_FRAME_denoiseColorPhi_info(paramType, infoName, infoType);
+      case 70:
+         return ANARI_FRAME_proxyPreview_info(paramType, infoName, infoType);
+      case 88:
+         return ANARI_FRAME_timeBudget_info(paramType, infoName, infoType);
+      case 55:
+         return ANARI_FRAME_name_info(paramType, infoName, infoType);
+      case 107:
+         return ANARI_FRAME_world_info(paramType, infoName, infoType);
+      case 72:
+         return ANARI_FRAME_renderer_info(paramType, infoName, infoType);
+      case 11:
+         return ANARI_FRAME_camera_info(paramType, infoName, infoType);
+      case 76:
+         return ANARI_FRAME_size_info(paramType, infoName, infoType);
+      case 13:
+         return ANARI_FRAME_channel_color_info(paramType, infoName, infoType);
+      case 14:
+         return ANARI_FRAME_channel_depth_info(paramType, infoName, infoType);
+      case 17:
+         return ANARI_FRAME_channel_primitiveId_info(paramType, infoName, infoType);
+      case 16:
+         return ANARI_FRAME_channel_objectId_info(paramType, infoName, infoType);
+      case 15:
+         return ANARI_FRAME_channel_instanceId_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_levelOfDetail_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1640,29 +2522,21 @@ static const void * ANARI_CAMERA_perspective_fovy_info(ANARIDataType paramType,
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
-            static const float default_value[1] = {1.047198f};
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "vertical field of view in radians";
+            static const char *description = "build a pyramid of downsampled levels and sample the one matching each ray footprint";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_aspect_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_levelOfDetailBias_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1673,28 +2547,20 @@ static const void * ANARI_CAMERA_perspective_aspect_info(ANARIDataType paramType
          }
       case 1: // default
          if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
-            static const float default_value[1] = {1.000000f};
+            static const float default_value[1] = {0.000000f};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "aspect ratio";
+            static const char *description = "offset added to the selected level of detail, positive values select coarser levels";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_near_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_levelOfDetailAsync_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1703,23 +2569,22 @@ static const void * ANARI_CAMERA_perspective_near_info(ANARIDataType paramType,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "near plane clip distance";
+            static const char *description = "build the level of detail pyramid in the background, rendering from the full resolution data until it is ready";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_far_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1730,78 +2595,53 @@ static const void * ANARI_CAMERA_perspective_far_info(ANARIDataType paramType, i
          }
       case 4: // description
          {
-            static const char *description = "far plane clip distance";
+            static const char *description = "optional object name";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 19;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_CAMERA_perspective_name_info(paramType, infoName, infoType);
-      case 44:
-         return ANARI_CAMERA_perspective_position_info(paramType, infoName, infoType);
-      case 20:
-         return ANARI_CAMERA_perspective_direction_info(paramType, infoName, infoType);
-      case 62:
-         return ANARI_CAMERA_perspective_up_info(paramType, infoName, infoType);
-      case 29:
-         return ANARI_CAMERA_perspective_imageRegion_info(paramType, infoName, infoType);
-      case 23:
-         return ANARI_CAMERA_perspective_fovy_info(paramType, infoName, infoType);
-      case 5:
-         return ANARI_CAMERA_perspective_aspect_info(paramType, infoName, infoType);
-      case 39:
-         return ANARI_CAMERA_perspective_near_info(paramType, infoName, infoType);
-      case 21:
-         return ANARI_CAMERA_perspective_far_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_VOLUME__id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_data_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "user id for objectId channel";
+            static const char *description = "array of vertex centered scalar values";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT8, ANARI_INT16, ANARI_UINT16, ANARI_FLOAT32, ANARI_FLOAT64, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_FRAME_CHANNEL_OBJECT_ID";
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
+            static const int32_t value = 19;
             return &value;
          }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_VOLUME__param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 27:
-         return ANARI_VOLUME__id_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
+      default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_origin_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1810,23 +2650,30 @@ static const void * ANARI_GEOMETRY_cone_name_info(ANARIDataType paramType, int i
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "origin of the grid in object-space";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 19;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1835,23 +2682,30 @@ static const void * ANARI_GEOMETRY_cone_color_info(ANARIDataType paramType, int
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {1.000000f, 1.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "uniform color";
+            static const char *description = "size of the grid cells in object-space";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 19;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1860,23 +2714,59 @@ static const void * ANARI_GEOMETRY_cone_attribute0_info(ANARIDataType paramType,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "linear";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "uniform attribute0";
+            static const char *description = "filter mode used to interpolate the grid";
             return description;
          }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"nearest", "linear", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 19;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 49:
+         return ANARI_SPATIAL_FIELD_structuredRegular_levelOfDetail_info(paramType, infoName, infoType);
+      case 51:
+         return ANARI_SPATIAL_FIELD_structuredRegular_levelOfDetailBias_info(paramType, infoName, infoType);
+      case 50:
+         return ANARI_SPATIAL_FIELD_structuredRegular_levelOfDetailAsync_info(paramType, infoName, infoType);
+      case 55:
+         return ANARI_SPATIAL_FIELD_structuredRegular_name_info(paramType, infoName, infoType);
+      case 19:
+         return ANARI_SPATIAL_FIELD_structuredRegular_data_info(paramType, infoName, infoType);
+      case 58:
+         return ANARI_SPATIAL_FIELD_structuredRegular_origin_info(paramType, infoName, infoType);
+      case 77:
+         return ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(paramType, infoName, infoType);
+      case 29:
+         return ANARI_SPATIAL_FIELD_structuredRegular_filter_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_ARRAY1D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1887,21 +2777,21 @@ static const void * ANARI_GEOMETRY_cone_attribute1_info(ANARIDataType paramType,
          }
       case 4: // description
          {
-            static const char *description = "uniform attribute1";
+            static const char *description = "optional object name";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_ARRAY1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 55:
+         return ANARI_ARRAY1D_name_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_ARRAY2D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1912,21 +2802,21 @@ static const void * ANARI_GEOMETRY_cone_attribute2_info(ANARIDataType paramType,
          }
       case 4: // description
          {
-            static const char *description = "uniform attribute2";
+            static const char *description = "optional object name";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_ARRAY2D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 55:
+         return ANARI_ARRAY2D_name_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_ARRAY3D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1937,21 +2827,21 @@ static const void * ANARI_GEOMETRY_cone_attribute3_info(ANARIDataType paramType,
          }
       case 4: // description
          {
-            static const char *description = "uniform attribute3";
+            static const char *description = "optional object name";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_ARRAY3D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 55:
+         return ANARI_ARRAY3D_name_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_GROUP_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1962,28 +2852,13 @@ static const void * ANARI_GEOMETRY_cone_primitive_color_info(ANARIDataType param
          }
       case 4: // description
          {
-            static const char *description = "per primitive color";
+            static const char *description = "optional object name";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_surface_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1994,28 +2869,20 @@ static const void * ANARI_GEOMETRY_cone_primitive_attribute0_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "per primitive attribute0";
+            static const char *description = "array of surface objects";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_SURFACE, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_volume_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2026,28 +2893,20 @@ static const void * ANARI_GEOMETRY_cone_primitive_attribute1_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "per primitive attribute1";
+            static const char *description = "array of volume objects";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_VOLUME, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_light_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2058,28 +2917,34 @@ static const void * ANARI_GEOMETRY_cone_primitive_attribute2_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "per primitive attribute2";
+            static const char *description = "array of light objects";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 55:
+         return ANARI_GROUP_name_info(paramType, infoName, infoType);
+      case 81:
+         return ANARI_GROUP_surface_info(paramType, infoName, infoType);
+      case 106:
+         return ANARI_GROUP_volume_info(paramType, infoName, infoType);
+      case 52:
+         return ANARI_GROUP_light_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_WORLD_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2090,28 +2955,13 @@ static const void * ANARI_GEOMETRY_cone_primitive_attribute3_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "per primitive attribute3";
+            static const char *description = "optional object name";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_WORLD_instance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2122,60 +2972,44 @@ static const void * ANARI_GEOMETRY_cone_primitive_id_info(ANARIDataType paramTyp
          }
       case 4: // description
          {
-            static const char *description = "primitive id";
+            static const char *description = "array of instance objects in the world";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UINT64, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_INSTANCE, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_WORLD_surface_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "vertex position";
+            static const char *description = "array of non-instanced surface objects in the world";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_SURFACE, ANARI_UNKNOWN};
             return values;
-         } else {
-            return nullptr;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
-            return &value;
+         } else {
+            return nullptr;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_vertex_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_WORLD_volume_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2186,28 +3020,20 @@ static const void * ANARI_GEOMETRY_cone_vertex_radius_info(ANARIDataType paramTy
          }
       case 4: // description
          {
-            static const char *description = "vertex radius";
+            static const char *description = "array of non-instanced volume objects in the world";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_vertex_cap_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_WORLD_light_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2218,28 +3044,36 @@ static const void * ANARI_GEOMETRY_cone_vertex_cap_info(ANARIDataType paramType,
          }
       case 4: // description
          {
-            static const char *description = "vertex cap type";
+            static const char *description = "array of non-instanced light objects in the world";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT8, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_WORLD_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 55:
+         return ANARI_WORLD_name_info(paramType, infoName, infoType);
+      case 46:
+         return ANARI_WORLD_instance_info(paramType, infoName, infoType);
+      case 81:
+         return ANARI_WORLD_surface_info(paramType, infoName, infoType);
+      case 106:
+         return ANARI_WORLD_volume_info(paramType, infoName, infoType);
+      case 52:
+         return ANARI_WORLD_light_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_SURFACE_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2250,60 +3084,47 @@ static const void * ANARI_GEOMETRY_cone_vertex_color_info(ANARIDataType paramTyp
          }
       case 4: // description
          {
-            static const char *description = "vertex color";
+            static const char *description = "optional object name";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SURFACE_geometry_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute0";
+            static const char *description = "geometry object defining the surface geometry";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SURFACE_material_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
          } else {
             return nullptr;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
-            return &value;
+      case 4: // description
+         {
+            static const char *description = "material object defining the surface appearance";
+            return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SURFACE_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2314,28 +3135,35 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute1_info(ANARIDataType par
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute1";
+            static const char *description = "user id for objectId channel";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
+            static const char *extension = "KHR_FRAME_CHANNEL_OBJECT_ID";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SURFACE_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 55:
+         return ANARI_SURFACE_name_info(paramType, infoName, infoType);
+      case 34:
+         return ANARI_SURFACE_geometry_info(paramType, infoName, infoType);
+      case 53:
+         return ANARI_SURFACE_material_info(paramType, infoName, infoType);
+      case 38:
+         return ANARI_SURFACE_id_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_INSTANCE_transform_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2346,28 +3174,21 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute2_info(ANARIDataType par
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute2";
+            static const char *description = "optional object name";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
+            static const char *extension = "KHR_INSTANCE_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 0;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_transform_transform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2376,62 +3197,67 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute3_info(ANARIDataType par
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "vertex attribute3";
+            static const char *description = "transform applied to objects in the instance";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
+            static const char *extension = "KHR_INSTANCE_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 0;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_transform_group_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "index array";
+            static const char *description = "group object being instanced";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32_VEC2, ANARI_UINT64_VEC2, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
+            static const char *extension = "KHR_INSTANCE_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 0;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_caps_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_transform_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 55:
+         return ANARI_INSTANCE_transform_name_info(paramType, infoName, infoType);
+      case 89:
+         return ANARI_INSTANCE_transform_transform_info(paramType, infoName, infoType);
+      case 35:
+         return ANARI_INSTANCE_transform_group_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_VOLUME__id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2440,87 +3266,31 @@ static const void * ANARI_GEOMETRY_cone_caps_info(ANARIDataType paramType, int i
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "none";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "global cap type";
+            static const char *description = "user id for objectId channel";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"none", "first", "second", "both", nullptr};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
+            static const char *extension = "KHR_FRAME_CHANNEL_OBJECT_ID";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
    }
-}
-static const void * ANARI_GEOMETRY_cone_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_GEOMETRY_cone_name_info(paramType, infoName, infoType);
-      case 18:
-         return ANARI_GEOMETRY_cone_color_info(paramType, infoName, infoType);
-      case 6:
-         return ANARI_GEOMETRY_cone_attribute0_info(paramType, infoName, infoType);
-      case 7:
-         return ANARI_GEOMETRY_cone_attribute1_info(paramType, infoName, infoType);
-      case 8:
-         return ANARI_GEOMETRY_cone_attribute2_info(paramType, infoName, infoType);
-      case 9:
-         return ANARI_GEOMETRY_cone_attribute3_info(paramType, infoName, infoType);
-      case 49:
-         return ANARI_GEOMETRY_cone_primitive_color_info(paramType, infoName, infoType);
-      case 45:
-         return ANARI_GEOMETRY_cone_primitive_attribute0_info(paramType, infoName, infoType);
-      case 46:
-         return ANARI_GEOMETRY_cone_primitive_attribute1_info(paramType, infoName, infoType);
-      case 47:
-         return ANARI_GEOMETRY_cone_primitive_attribute2_info(paramType, infoName, infoType);
-      case 48:
-         return ANARI_GEOMETRY_cone_primitive_attribute3_info(paramType, infoName, infoType);
-      case 50:
-         return ANARI_GEOMETRY_cone_primitive_id_info(paramType, infoName, infoType);
-      case 72:
-         return ANARI_GEOMETRY_cone_vertex_position_info(paramType, infoName, infoType);
-      case 73:
-         return ANARI_GEOMETRY_cone_vertex_radius_info(paramType, infoName, infoType);
-      case 69:
-         return ANARI_GEOMETRY_cone_vertex_cap_info(paramType, infoName, infoType);
-      case 70:
-         return ANARI_GEOMETRY_cone_vertex_color_info(paramType, infoName, infoType);
-      case 65:
-         return ANARI_GEOMETRY_cone_vertex_attribute0_info(paramType, infoName, infoType);
-      case 66:
-         return ANARI_GEOMETRY_cone_vertex_attribute1_info(paramType, infoName, infoType);
-      case 67:
-         return ANARI_GEOMETRY_cone_vertex_attribute2_info(paramType, infoName, infoType);
-      case 68:
-         return ANARI_GEOMETRY_cone_vertex_attribute3_info(paramType, infoName, infoType);
-      case 51:
-         return ANARI_GEOMETRY_cone_primitive_index_info(paramType, infoName, infoType);
-      case 12:
-         return ANARI_GEOMETRY_cone_caps_info(paramType, infoName, infoType);
+}
+static const void * ANARI_VOLUME__param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 38:
+         return ANARI_VOLUME__id_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2536,16 +3306,16 @@ static const void * ANARI_GEOMETRY_curve_name_info(ANARIDataType paramType, int
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2561,16 +3331,16 @@ static const void * ANARI_GEOMETRY_curve_color_info(ANARIDataType paramType, int
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2586,16 +3356,16 @@ static const void * ANARI_GEOMETRY_curve_attribute0_info(ANARIDataType paramType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2611,16 +3381,16 @@ static const void * ANARI_GEOMETRY_curve_attribute1_info(ANARIDataType paramType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2636,16 +3406,16 @@ static const void * ANARI_GEOMETRY_curve_attribute2_info(ANARIDataType paramType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2661,16 +3431,16 @@ static const void * ANARI_GEOMETRY_curve_attribute3_info(ANARIDataType paramType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2693,16 +3463,16 @@ static const void * ANARI_GEOMETRY_curve_primitive_color_info(ANARIDataType para
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2725,16 +3495,16 @@ static const void * ANARI_GEOMETRY_curve_primitive_attribute0_info(ANARIDataType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2757,16 +3527,16 @@ static const void * ANARI_GEOMETRY_curve_primitive_attribute1_info(ANARIDataType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2789,16 +3559,16 @@ static const void * ANARI_GEOMETRY_curve_primitive_attribute2_info(ANARIDataType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2821,16 +3591,16 @@ static const void * ANARI_GEOMETRY_curve_primitive_attribute3_info(ANARIDataType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2853,16 +3623,16 @@ static const void * ANARI_GEOMETRY_curve_primitive_id_info(ANARIDataType paramTy
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2885,16 +3655,16 @@ static const void * ANARI_GEOMETRY_curve_vertex_position_info(ANARIDataType para
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_vertex_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_vertex_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2917,16 +3687,48 @@ static const void * ANARI_GEOMETRY_curve_vertex_radius_info(ANARIDataType paramT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_vertex_cap_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex cap type";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT8, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_CONE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 7;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_cone_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2949,16 +3751,16 @@ static const void * ANARI_GEOMETRY_curve_vertex_color_info(ANARIDataType paramTy
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2981,16 +3783,16 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute0_info(ANARIDataType pa
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3013,16 +3815,16 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute1_info(ANARIDataType pa
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3045,16 +3847,16 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute2_info(ANARIDataType pa
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3077,16 +3879,16 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute3_info(ANARIDataType pa
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3102,23 +3904,23 @@ static const void * ANARI_GEOMETRY_curve_primitive_index_info(ANARIDataType para
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UINT64, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_UINT32_VEC2, ANARI_UINT64_VEC2, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_caps_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3127,71 +3929,87 @@ static const void * ANARI_GEOMETRY_curve_radius_info(ANARIDataType paramType, in
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "none";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "global radius";
+            static const char *description = "global cap type";
             return description;
          }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"none", "first", "second", "both", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_GEOMETRY_curve_name_info(paramType, infoName, infoType);
+      case 55:
+         return ANARI_GEOMETRY_cone_name_info(paramType, infoName, infoType);
       case 18:
-         return ANARI_GEOMETRY_curve_color_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_cone_color_info(paramType, infoName, infoType);
       case 6:
-         return ANARI_GEOMETRY_curve_attribute0_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_cone_attribute0_info(paramType, infoName, infoType);
       case 7:
-         return ANARI_GEOMETRY_curve_attribute1_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_cone_attribute1_info(paramType, infoName, infoType);
       case 8:
-         return ANARI_GEOMETRY_curve_attribute2_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_cone_attribute2_info(paramType, infoName, infoType);
       case 9:
-         return ANARI_GEOMETRY_curve_attribute3_info(paramType, infoName, infoType);
-      case 49:
-         return ANARI_GEOMETRY_curve_primitive_color_info(paramType, infoName, infoType);
-      case 45:
-         return ANARI_GEOMETRY_curve_primitive_attribute0_info(paramType, infoName, infoType);
-      case 46:
-         return ANARI_GEOMETRY_curve_primitive_attribute1_info(paramType, infoName, infoType);
-      case 47:
-         return ANARI_GEOMETRY_curve_primitive_attribute2_info(paramType, infoName, infoType);
-      case 48:
-         return ANARI_GEOMETRY_curve_primitive_attribute3_info(paramType, infoName, infoType);
-      case 50:
-         return ANARI_GEOMETRY_curve_primitive_id_info(paramType, infoName, infoType);
-      case 72:
-         return ANARI_GEOMETRY_curve_vertex_position_info(paramType, infoName, infoType);
-      case 73:
-         return ANARI_GEOMETRY_curve_vertex_radius_info(paramType, infoName, infoType);
-      case 70:
-         return ANARI_GEOMETRY_curve_vertex_color_info(paramType, infoName, infoType);
-      case 65:
-         return ANARI_GEOMETRY_curve_vertex_attribute0_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_cone_attribute3_info(paramType, infoName, infoType);
       case 66:
-         return ANARI_GEOMETRY_curve_vertex_attribute1_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_cone_primitive_color_info(paramType, infoName, infoType);
+      case 62:
+         return ANARI_GEOMETRY_cone_primitive_attribute0_info(paramType, infoName, infoType);
+      case 63:
+         return ANARI_GEOMETRY_cone_primitive_attribute1_info(paramType, infoName, infoType);
+      case 64:
+         return ANARI_GEOMETRY_cone_primitive_attribute2_info(paramType, infoName, infoType);
+      case 65:
+         return ANARI_GEOMETRY_cone_primitive_attribute3_info(paramType, infoName, infoType);
       case 67:
-         return ANARI_GEOMETRY_curve_vertex_attribute2_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_cone_primitive_id_info(paramType, infoName, infoType);
+      case 101:
+         return ANARI_GEOMETRY_cone_vertex_position_info(paramType, infoName, infoType);
+      case 102:
+         return ANARI_GEOMETRY_cone_vertex_radius_info(paramType, infoName, infoType);
+      case 98:
+         return ANARI_GEOMETRY_cone_vertex_cap_info(paramType, infoName, infoType);
+      case 99:
+         return ANARI_GEOMETRY_cone_vertex_color_info(paramType, infoName, infoType);
+      case 94:
+         return ANARI_GEOMETRY_cone_vertex_attribute0_info(paramType, infoName, infoType);
+      case 95:
+         return ANARI_GEOMETRY_cone_vertex_attribute1_info(paramType, infoName, infoType);
+      case 96:
+         return ANARI_GEOMETRY_cone_vertex_attribute2_info(paramType, infoName, infoType);
+      case 97:
+         return ANARI_GEOMETRY_cone_vertex_attribute3_info(paramType, infoName, infoType);
       case 68:
-         return ANARI_GEOMETRY_curve_vertex_attribute3_info(paramType, infoName, infoType);
-      case 51:
-         return ANARI_GEOMETRY_curve_primitive_index_info(paramType, infoName, infoType);
-      case 53:
-         return ANARI_GEOMETRY_curve_radius_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_cone_primitive_index_info(paramType, infoName, infoType);
+      case 12:
+         return ANARI_GEOMETRY_cone_caps_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3207,16 +4025,16 @@ static const void * ANARI_GEOMETRY_cylinder_name_info(ANARIDataType paramType, i
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3232,16 +4050,16 @@ static const void * ANARI_GEOMETRY_cylinder_color_info(ANARIDataType paramType,
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3257,16 +4075,16 @@ static const void * ANARI_GEOMETRY_cylinder_attribute0_info(ANARIDataType paramT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3282,16 +4100,16 @@ static const void * ANARI_GEOMETRY_cylinder_attribute1_info(ANARIDataType paramT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3307,16 +4125,16 @@ static const void * ANARI_GEOMETRY_cylinder_attribute2_info(ANARIDataType paramT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3332,16 +4150,16 @@ static const void * ANARI_GEOMETRY_cylinder_attribute3_info(ANARIDataType paramT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3364,16 +4182,16 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_color_info(ANARIDataType p
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3396,16 +4214,16 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute0_info(ANARIDataT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3428,16 +4246,16 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute1_info(ANARIDataT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3460,16 +4278,16 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute2_info(ANARIDataT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3492,16 +4310,16 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute3_info(ANARIDataT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3524,16 +4342,16 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_id_info(ANARIDataType para
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3556,16 +4374,16 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_position_info(ANARIDataType p
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_vertex_cap_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_vertex_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3576,28 +4394,28 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_cap_info(ANARIDataType paramT
          }
       case 4: // description
          {
-            static const char *description = "cylinder cap type";
+            static const char *description = "vertex radius";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT8, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3620,16 +4438,16 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_color_info(ANARIDataType para
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3652,16 +4470,16 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_attribute0_info(ANARIDataType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3684,16 +4502,16 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_attribute1_info(ANARIDataType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3716,16 +4534,16 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_attribute2_info(ANARIDataType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3748,16 +4566,16 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_attribute3_info(ANARIDataType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3773,80 +4591,23 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_index_info(ANARIDataType p
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32_VEC2, ANARI_UINT64_VEC2, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
-            return &value;
-         }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_GEOMETRY_cylinder_primitive_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   (void)paramType;
-   switch(infoName) {
-      case 0: // required
-         if(infoType == ANARI_BOOL) {
-            return &anari_false;
-         } else {
-            return nullptr;
-         }
-      case 4: // description
-         {
-            static const char *description = "cylinder radius";
-            return description;
-         }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UINT64, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
-            return &value;
-         }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_GEOMETRY_cylinder_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   (void)paramType;
-   switch(infoName) {
-      case 0: // required
-         if(infoType == ANARI_BOOL) {
-            return &anari_false;
-         } else {
-            return nullptr;
-         }
-      case 4: // description
-         {
-            static const char *description = "global cylinder radius";
-            return description;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_caps_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3855,89 +4616,71 @@ static const void * ANARI_GEOMETRY_cylinder_caps_info(ANARIDataType paramType, i
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "none";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "global cylinder cap type";
+            static const char *description = "global radius";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"none", "first", "second", "both", nullptr};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_GEOMETRY_cylinder_name_info(paramType, infoName, infoType);
+      case 55:
+         return ANARI_GEOMETRY_curve_name_info(paramType, infoName, infoType);
       case 18:
-         return ANARI_GEOMETRY_cylinder_color_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_curve_color_info(paramType, infoName, infoType);
       case 6:
-         return ANARI_GEOMETRY_cylinder_attribute0_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_curve_attribute0_info(paramType, infoName, infoType);
       case 7:
-         return ANARI_GEOMETRY_cylinder_attribute1_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_curve_attribute1_info(paramType, infoName, infoType);
       case 8:
-         return ANARI_GEOMETRY_cylinder_attribute2_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_curve_attribute2_info(paramType, infoName, infoType);
       case 9:
-         return ANARI_GEOMETRY_cylinder_attribute3_info(paramType, infoName, infoType);
-      case 49:
-         return ANARI_GEOMETRY_cylinder_primitive_color_info(paramType, infoName, infoType);
-      case 45:
-         return ANARI_GEOMETRY_cylinder_primitive_attribute0_info(paramType, infoName, infoType);
-      case 46:
-         return ANARI_GEOMETRY_cylinder_primitive_attribute1_info(paramType, infoName, infoType);
-      case 47:
-         return ANARI_GEOMETRY_cylinder_primitive_attribute2_info(paramType, infoName, infoType);
-      case 48:
-         return ANARI_GEOMETRY_cylinder_primitive_attribute3_info(paramType, infoName, infoType);
-      case 50:
-         return ANARI_GEOMETRY_cylinder_primitive_id_info(paramType, infoName, infoType);
-      case 72:
-         return ANARI_GEOMETRY_cylinder_vertex_position_info(paramType, infoName, infoType);
-      case 69:
-         return ANARI_GEOMETRY_cylinder_vertex_cap_info(paramType, infoName, infoType);
-      case 70:
-         return ANARI_GEOMETRY_cylinder_vertex_color_info(paramType, infoName, infoType);
-      case 65:
-         return ANARI_GEOMETRY_cylinder_vertex_attribute0_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_curve_attribute3_info(paramType, infoName, infoType);
       case 66:
-         return ANARI_GEOMETRY_cylinder_vertex_attribute1_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_curve_primitive_color_info(paramType, infoName, infoType);
+      case 62:
+         return ANARI_GEOMETRY_curve_primitive_attribute0_info(paramType, infoName, infoType);
+      case 63:
+         return ANARI_GEOMETRY_curve_primitive_attribute1_info(paramType, infoName, infoType);
+      case 64:
+         return ANARI_GEOMETRY_curve_primitive_attribute2_info(paramType, infoName, infoType);
+      case 65:
+         return ANARI_GEOMETRY_curve_primitive_attribute3_info(paramType, infoName, infoType);
       case 67:
-         return ANARI_GEOMETRY_cylinder_vertex_attribute2_info(paramType, infoName, infoType);
-      case 68:
-         return ANARI_GEOMETRY_cylinder_vertex_attribute3_info(paramType, infoName, infoType);
-      case 51:
-         return ANARI_GEOMETRY_cylinder_primitive_index_info(paramType, infoName, infoType);
-      case 52:
-         return ANARI_GEOMETRY_cylinder_primitive_radius_info(paramType, infoName, infoType);
-      case 53:
-         return ANARI_GEOMETRY_cylinder_radius_info(paramType, infoName, infoType);
-      case 12:
-         return ANARI_GEOMETRY_cylinder_caps_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_curve_primitive_id_info(paramType, infoName, infoType);
+      case 101:
+         return ANARI_GEOMETRY_curve_vertex_position_info(paramType, infoName, infoType);
+      case 102:
+         return ANARI_GEOMETRY_curve_vertex_radius_info(paramType, infoName, infoType);
+      case 99:
+         return ANARI_GEOMETRY_curve_vertex_color_info(paramType, infoName, infoType);
+      case 94:
+         return ANARI_GEOMETRY_curve_vertex_attribute0_info(paramType, infoName, infoType);
+      case 95:
+         return ANARI_GEOMETRY_curve_vertex_attribute1_info(paramType, infoName, infoType);
+      case 96:
+         return ANARI_GEOMETRY_curve_vertex_attribute2_info(paramType, infoName, infoType);
+      case 97:
+         return ANARI_GEOMETRY_curve_vertex_attribute3_info(paramType, infoName, infoType);
+      case 68:
+         return ANARI_GEOMETRY_curve_primitive_index_info(paramType, infoName, infoType);
+      case 71:
+         return ANARI_GEOMETRY_curve_radius_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3953,16 +4696,16 @@ static const void * ANARI_GEOMETRY_quad_name_info(ANARIDataType paramType, int i
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3978,16 +4721,16 @@ static const void * ANARI_GEOMETRY_quad_color_info(ANARIDataType paramType, int
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4003,16 +4746,16 @@ static const void * ANARI_GEOMETRY_quad_attribute0_info(ANARIDataType paramType,
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4028,16 +4771,16 @@ static const void * ANARI_GEOMETRY_quad_attribute1_info(ANARIDataType paramType,
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4053,16 +4796,16 @@ static const void * ANARI_GEOMETRY_quad_attribute2_info(ANARIDataType paramType,
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4078,16 +4821,16 @@ static const void * ANARI_GEOMETRY_quad_attribute3_info(ANARIDataType paramType,
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4110,16 +4853,16 @@ static const void * ANARI_GEOMETRY_quad_primitive_color_info(ANARIDataType param
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4142,16 +4885,16 @@ static const void * ANARI_GEOMETRY_quad_primitive_attribute0_info(ANARIDataType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4174,16 +4917,16 @@ static const void * ANARI_GEOMETRY_quad_primitive_attribute1_info(ANARIDataType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4206,16 +4949,16 @@ static const void * ANARI_GEOMETRY_quad_primitive_attribute2_info(ANARIDataType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4238,16 +4981,16 @@ static const void * ANARI_GEOMETRY_quad_primitive_attribute3_info(ANARIDataType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4270,16 +5013,16 @@ static const void * ANARI_GEOMETRY_quad_primitive_id_info(ANARIDataType paramTyp
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4302,16 +5045,16 @@ static const void * ANARI_GEOMETRY_quad_vertex_position_info(ANARIDataType param
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_vertex_normal_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_vertex_cap_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4322,28 +5065,28 @@ static const void * ANARI_GEOMETRY_quad_vertex_normal_info(ANARIDataType paramTy
          }
       case 4: // description
          {
-            static const char *description = "vertex normal";
+            static const char *description = "cylinder cap type";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_FIXED16_VEC3, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_UINT8, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_vertex_tangent_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4354,28 +5097,28 @@ static const void * ANARI_GEOMETRY_quad_vertex_tangent_info(ANARIDataType paramT
          }
       case 4: // description
          {
-            static const char *description = "vertex normal";
+            static const char *description = "vertex color";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_FIXED16_VEC3, ANARI_FLOAT32_VEC4, ANARI_FIXED16_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4386,28 +5129,28 @@ static const void * ANARI_GEOMETRY_quad_vertex_color_info(ANARIDataType paramTyp
          }
       case 4: // description
          {
-            static const char *description = "vertex color";
+            static const char *description = "vertex attribute0";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4418,7 +5161,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute0_info(ANARIDataType par
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute0";
+            static const char *description = "vertex attribute1";
             return description;
          }
       case 5: // elementType
@@ -4430,16 +5173,16 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute0_info(ANARIDataType par
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4450,7 +5193,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute1_info(ANARIDataType par
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute1";
+            static const char *description = "vertex attribute2";
             return description;
          }
       case 5: // elementType
@@ -4462,16 +5205,16 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute1_info(ANARIDataType par
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4482,7 +5225,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute2_info(ANARIDataType par
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute2";
+            static const char *description = "vertex attribute3";
             return description;
          }
       case 5: // elementType
@@ -4494,16 +5237,16 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute2_info(ANARIDataType par
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4514,28 +5257,28 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute3_info(ANARIDataType par
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute3";
+            static const char *description = "index array";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_UINT32_VEC2, ANARI_UINT64_VEC2, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4546,76 +5289,144 @@ static const void * ANARI_GEOMETRY_quad_primitive_index_info(ANARIDataType param
          }
       case 4: // description
          {
-            static const char *description = "index array";
+            static const char *description = "cylinder radius";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32_VEC4, ANARI_UINT64_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_GEOMETRY_quad_name_info(paramType, infoName, infoType);
-      case 18:
-         return ANARI_GEOMETRY_quad_color_info(paramType, infoName, infoType);
-      case 6:
-         return ANARI_GEOMETRY_quad_attribute0_info(paramType, infoName, infoType);
-      case 7:
-         return ANARI_GEOMETRY_quad_attribute1_info(paramType, infoName, infoType);
-      case 8:
-         return ANARI_GEOMETRY_quad_attribute2_info(paramType, infoName, infoType);
-      case 9:
-         return ANARI_GEOMETRY_quad_attribute3_info(paramType, infoName, infoType);
-      case 49:
-         return ANARI_GEOMETRY_quad_primitive_color_info(paramType, infoName, infoType);
-      case 45:
-         return ANARI_GEOMETRY_quad_primitive_attribute0_info(paramType, infoName, infoType);
-      case 46:
-         return ANARI_GEOMETRY_quad_primitive_attribute1_info(paramType, infoName, infoType);
-      case 47:
-         return ANARI_GEOMETRY_quad_primitive_attribute2_info(paramType, infoName, infoType);
-      case 48:
-         return ANARI_GEOMETRY_quad_primitive_attribute3_info(paramType, infoName, infoType);
-      case 50:
-         return ANARI_GEOMETRY_quad_primitive_id_info(paramType, infoName, infoType);
-      case 72:
-         return ANARI_GEOMETRY_quad_vertex_position_info(paramType, infoName, infoType);
-      case 71:
-         return ANARI_GEOMETRY_quad_vertex_normal_info(paramType, infoName, infoType);
-      case 74:
-         return ANARI_GEOMETRY_quad_vertex_tangent_info(paramType, infoName, infoType);
-      case 70:
-         return ANARI_GEOMETRY_quad_vertex_color_info(paramType, infoName, infoType);
-      case 65:
-         return ANARI_GEOMETRY_quad_vertex_attribute0_info(paramType, infoName, infoType);
+static const void * ANARI_GEOMETRY_cylinder_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "global cylinder radius";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 9;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_cylinder_caps_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "none";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "global cylinder cap type";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"none", "first", "second", "both", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 9;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_cylinder_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 55:
+         return ANARI_GEOMETRY_cylinder_name_info(paramType, infoName, infoType);
+      case 18:
+         return ANARI_GEOMETRY_cylinder_color_info(paramType, infoName, infoType);
+      case 6:
+         return ANARI_GEOMETRY_cylinder_attribute0_info(paramType, infoName, infoType);
+      case 7:
+         return ANARI_GEOMETRY_cylinder_attribute1_info(paramType, infoName, infoType);
+      case 8:
+         return ANARI_GEOMETRY_cylinder_attribute2_info(paramType, infoName, infoType);
+      case 9:
+         return ANARI_GEOMETRY_cylinder_attribute3_info(paramType, infoName, infoType);
       case 66:
-         return ANARI_GEOMETRY_quad_vertex_attribute1_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_cylinder_primitive_color_info(paramType, infoName, infoType);
+      case 62:
+         return ANARI_GEOMETRY_cylinder_primitive_attribute0_info(paramType, infoName, infoType);
+      case 63:
+         return ANARI_GEOMETRY_cylinder_primitive_attribute1_info(paramType, infoName, infoType);
+      case 64:
+         return ANARI_GEOMETRY_cylinder_primitive_attribute2_info(paramType, infoName, infoType);
+      case 65:
+         return ANARI_GEOMETRY_cylinder_primitive_attribute3_info(paramType, infoName, infoType);
       case 67:
-         return ANARI_GEOMETRY_quad_vertex_attribute2_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_cylinder_primitive_id_info(paramType, infoName, infoType);
+      case 101:
+         return ANARI_GEOMETRY_cylinder_vertex_position_info(paramType, infoName, infoType);
+      case 98:
+         return ANARI_GEOMETRY_cylinder_vertex_cap_info(paramType, infoName, infoType);
+      case 99:
+         return ANARI_GEOMETRY_cylinder_vertex_color_info(paramType, infoName, infoType);
+      case 94:
+         return ANARI_GEOMETRY_cylinder_vertex_attribute0_info(paramType, infoName, infoType);
+      case 95:
+         return ANARI_GEOMETRY_cylinder_vertex_attribute1_info(paramType, infoName, infoType);
+      case 96:
+         return ANARI_GEOMETRY_cylinder_vertex_attribute2_info(paramType, infoName, infoType);
+      case 97:
+         return ANARI_GEOMETRY_cylinder_vertex_attribute3_info(paramType, infoName, infoType);
       case 68:
-         return ANARI_GEOMETRY_quad_vertex_attribute3_info(paramType, infoName, infoType);
-      case 51:
-         return ANARI_GEOMETRY_quad_primitive_index_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_cylinder_primitive_index_info(paramType, infoName, infoType);
+      case 69:
+         return ANARI_GEOMETRY_cylinder_primitive_radius_info(paramType, infoName, infoType);
+      case 71:
+         return ANARI_GEOMETRY_cylinder_radius_info(paramType, infoName, infoType);
+      case 12:
+         return ANARI_GEOMETRY_cylinder_caps_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4631,16 +5442,16 @@ static const void * ANARI_GEOMETRY_sphere_name_info(ANARIDataType paramType, int
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4656,16 +5467,16 @@ static const void * ANARI_GEOMETRY_sphere_color_info(ANARIDataType paramType, in
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4681,16 +5492,16 @@ static const void * ANARI_GEOMETRY_sphere_attribute0_info(ANARIDataType paramTyp
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4706,16 +5517,16 @@ static const void * ANARI_GEOMETRY_sphere_attribute1_info(ANARIDataType paramTyp
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4731,16 +5542,16 @@ static const void * ANARI_GEOMETRY_sphere_attribute2_info(ANARIDataType paramTyp
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4756,16 +5567,16 @@ static const void * ANARI_GEOMETRY_sphere_attribute3_info(ANARIDataType paramTyp
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4788,16 +5599,16 @@ static const void * ANARI_GEOMETRY_sphere_primitive_color_info(ANARIDataType par
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4820,16 +5631,16 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute0_info(ANARIDataTyp
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4852,16 +5663,16 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute1_info(ANARIDataTyp
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4884,16 +5695,16 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute2_info(ANARIDataTyp
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4916,16 +5727,16 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute3_info(ANARIDataTyp
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4948,16 +5759,16 @@ static const void * ANARI_GEOMETRY_sphere_primitive_id_info(ANARIDataType paramT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4968,7 +5779,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_position_info(ANARIDataType par
          }
       case 4: // description
          {
-            static const char *description = "sphere position";
+            static const char *description = "vertex position";
             return description;
          }
       case 5: // elementType
@@ -4980,16 +5791,16 @@ static const void * ANARI_GEOMETRY_sphere_vertex_position_info(ANARIDataType par
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_vertex_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_vertex_normal_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5000,28 +5811,28 @@ static const void * ANARI_GEOMETRY_sphere_vertex_radius_info(ANARIDataType param
          }
       case 4: // description
          {
-            static const char *description = "sphere radius";
+            static const char *description = "vertex normal";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_FIXED16_VEC3, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_vertex_tangent_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5032,28 +5843,28 @@ static const void * ANARI_GEOMETRY_sphere_vertex_color_info(ANARIDataType paramT
          }
       case 4: // description
          {
-            static const char *description = "vertex color";
+            static const char *description = "vertex normal";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_FIXED16_VEC3, ANARI_FLOAT32_VEC4, ANARI_FIXED16_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5064,28 +5875,28 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute0_info(ANARIDataType p
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute0";
+            static const char *description = "vertex color";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5096,7 +5907,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute1_info(ANARIDataType p
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute1";
+            static const char *description = "vertex attribute0";
             return description;
          }
       case 5: // elementType
@@ -5108,16 +5919,16 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute1_info(ANARIDataType p
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5128,7 +5939,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute2_info(ANARIDataType p
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute2";
+            static const char *description = "vertex attribute1";
             return description;
          }
       case 5: // elementType
@@ -5140,16 +5951,16 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute2_info(ANARIDataType p
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5160,7 +5971,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute3_info(ANARIDataType p
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute3";
+            static const char *description = "vertex attribute2";
             return description;
          }
       case 5: // elementType
@@ -5172,16 +5983,16 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute3_info(ANARIDataType p
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5192,28 +6003,28 @@ static const void * ANARI_GEOMETRY_sphere_primitive_index_info(ANARIDataType par
          }
       case 4: // description
          {
-            static const char *description = "index array";
+            static const char *description = "vertex attribute3";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UINT64, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5224,69 +6035,76 @@ static const void * ANARI_GEOMETRY_sphere_radius_info(ANARIDataType paramType, i
          }
       case 4: // description
          {
-            static const char *description = "global sphere radius";
+            static const char *description = "index array";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32_VEC4, ANARI_UINT64_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_GEOMETRY_sphere_name_info(paramType, infoName, infoType);
+      case 55:
+         return ANARI_GEOMETRY_quad_name_info(paramType, infoName, infoType);
       case 18:
-         return ANARI_GEOMETRY_sphere_color_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_quad_color_info(paramType, infoName, infoType);
       case 6:
-         return ANARI_GEOMETRY_sphere_attribute0_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_quad_attribute0_info(paramType, infoName, infoType);
       case 7:
-         return ANARI_GEOMETRY_sphere_attribute1_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_quad_attribute1_info(paramType, infoName, infoType);
       case 8:
-         return ANARI_GEOMETRY_sphere_attribute2_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_quad_attribute2_info(paramType, infoName, infoType);
       case 9:
-         return ANARI_GEOMETRY_sphere_attribute3_info(paramType, infoName, infoType);
-      case 49:
-         return ANARI_GEOMETRY_sphere_primitive_color_info(paramType, infoName, infoType);
-      case 45:
-         return ANARI_GEOMETRY_sphere_primitive_attribute0_info(paramType, infoName, infoType);
-      case 46:
-         return ANARI_GEOMETRY_sphere_primitive_attribute1_info(paramType, infoName, infoType);
-      case 47:
-         return ANARI_GEOMETRY_sphere_primitive_attribute2_info(paramType, infoName, infoType);
-      case 48:
-         return ANARI_GEOMETRY_sphere_primitive_attribute3_info(paramType, infoName, infoType);
-      case 50:
-         return ANARI_GEOMETRY_sphere_primitive_id_info(paramType, infoName, infoType);
-      case 72:
-         return ANARI_GEOMETRY_sphere_vertex_position_info(paramType, infoName, infoType);
-      case 73:
-         return ANARI_GEOMETRY_sphere_vertex_radius_info(paramType, infoName, infoType);
-      case 70:
-         return ANARI_GEOMETRY_sphere_vertex_color_info(paramType, infoName, infoType);
-      case 65:
-         return ANARI_GEOMETRY_sphere_vertex_attribute0_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_quad_attribute3_info(paramType, infoName, infoType);
       case 66:
-         return ANARI_GEOMETRY_sphere_vertex_attribute1_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_quad_primitive_color_info(paramType, infoName, infoType);
+      case 62:
+         return ANARI_GEOMETRY_quad_primitive_attribute0_info(paramType, infoName, infoType);
+      case 63:
+         return ANARI_GEOMETRY_quad_primitive_attribute1_info(paramType, infoName, infoType);
+      case 64:
+         return ANARI_GEOMETRY_quad_primitive_attribute2_info(paramType, infoName, infoType);
+      case 65:
+         return ANARI_GEOMETRY_quad_primitive_attribute3_info(paramType, infoName, infoType);
       case 67:
-         return ANARI_GEOMETRY_sphere_vertex_attribute2_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_quad_primitive_id_info(paramType, infoName, infoType);
+      case 101:
+         return ANARI_GEOMETRY_quad_vertex_position_info(paramType, infoName, infoType);
+      case 100:
+         return ANARI_GEOMETRY_quad_vertex_normal_info(paramType, infoName, infoType);
+      case 103:
+         return ANARI_GEOMETRY_quad_vertex_tangent_info(paramType, infoName, infoType);
+      case 99:
+         return ANARI_GEOMETRY_quad_vertex_color_info(paramType, infoName, infoType);
+      case 94:
+         return ANARI_GEOMETRY_quad_vertex_attribute0_info(paramType, infoName, infoType);
+      case 95:
+         return ANARI_GEOMETRY_quad_vertex_attribute1_info(paramType, infoName, infoType);
+      case 96:
+         return ANARI_GEOMETRY_quad_vertex_attribute2_info(paramType, infoName, infoType);
+      case 97:
+         return ANARI_GEOMETRY_quad_vertex_attribute3_info(paramType, infoName, infoType);
       case 68:
-         return ANARI_GEOMETRY_sphere_vertex_attribute3_info(paramType, infoName, infoType);
-      case 51:
-         return ANARI_GEOMETRY_sphere_primitive_index_info(paramType, infoName, infoType);
-      case 53:
-         return ANARI_GEOMETRY_sphere_radius_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_quad_primitive_index_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5302,16 +6120,16 @@ static const void * ANARI_GEOMETRY_triangle_name_info(ANARIDataType paramType, i
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5327,16 +6145,16 @@ static const void * ANARI_GEOMETRY_triangle_color_info(ANARIDataType paramType,
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5352,16 +6170,16 @@ static const void * ANARI_GEOMETRY_triangle_attribute0_info(ANARIDataType paramT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5377,16 +6195,16 @@ static const void * ANARI_GEOMETRY_triangle_attribute1_info(ANARIDataType paramT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5402,16 +6220,16 @@ static const void * ANARI_GEOMETRY_triangle_attribute2_info(ANARIDataType paramT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5427,16 +6245,16 @@ static const void * ANARI_GEOMETRY_triangle_attribute3_info(ANARIDataType paramT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5459,16 +6277,16 @@ static const void * ANARI_GEOMETRY_triangle_primitive_color_info(ANARIDataType p
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5491,16 +6309,16 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute0_info(ANARIDataT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5523,16 +6341,16 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute1_info(ANARIDataT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5555,16 +6373,16 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute2_info(ANARIDataT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5587,16 +6405,16 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute3_info(ANARIDataT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5619,16 +6437,16 @@ static const void * ANARI_GEOMETRY_triangle_primitive_id_info(ANARIDataType para
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5639,7 +6457,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_position_info(ANARIDataType p
          }
       case 4: // description
          {
-            static const char *description = "vertex position";
+            static const char *description = "sphere position";
             return description;
          }
       case 5: // elementType
@@ -5651,16 +6469,16 @@ static const void * ANARI_GEOMETRY_triangle_vertex_position_info(ANARIDataType p
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_normal_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_vertex_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5671,28 +6489,28 @@ static const void * ANARI_GEOMETRY_triangle_vertex_normal_info(ANARIDataType par
          }
       case 4: // description
          {
-            static const char *description = "vertex normal";
+            static const char *description = "sphere radius";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_FIXED16_VEC3, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_tangent_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5703,28 +6521,28 @@ static const void * ANARI_GEOMETRY_triangle_vertex_tangent_info(ANARIDataType pa
          }
       case 4: // description
          {
-            static const char *description = "vertex normal";
+            static const char *description = "vertex color";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_FIXED16_VEC3, ANARI_FLOAT32_VEC4, ANARI_FIXED16_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5735,28 +6553,28 @@ static const void * ANARI_GEOMETRY_triangle_vertex_color_info(ANARIDataType para
          }
       case 4: // description
          {
-            static const char *description = "vertex color";
+            static const char *description = "vertex attribute0";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5767,7 +6585,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute0_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute0";
+            static const char *description = "vertex attribute1";
             return description;
          }
       case 5: // elementType
@@ -5779,16 +6597,16 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute0_info(ANARIDataType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5799,7 +6617,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute1_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute1";
+            static const char *description = "vertex attribute2";
             return description;
          }
       case 5: // elementType
@@ -5811,16 +6629,153 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute1_info(ANARIDataType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 11;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_sphere_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex attribute3";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 11;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_sphere_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "index array";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UINT64, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 11;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_sphere_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "global sphere radius";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 55:
+         return ANARI_GEOMETRY_sphere_name_info(paramType, infoName, infoType);
+      case 18:
+         return ANARI_GEOMETRY_sphere_color_info(paramType, infoName, infoType);
+      case 6:
+         return ANARI_GEOMETRY_sphere_attribute0_info(paramType, infoName, infoType);
+      case 7:
+         return ANARI_GEOMETRY_sphere_attribute1_info(paramType, infoName, infoType);
+      case 8:
+         return ANARI_GEOMETRY_sphere_attribute2_info(paramType, infoName, infoType);
+      case 9:
+         return ANARI_GEOMETRY_sphere_attribute3_info(paramType, infoName, infoType);
+      case 66:
+         return ANARI_GEOMETRY_sphere_primitive_color_info(paramType, infoName, infoType);
+      case 62:
+         return ANARI_GEOMETRY_sphere_primitive_attribute0_info(paramType, infoName, infoType);
+      case 63:
+         return ANARI_GEOMETRY_sphere_primitive_attribute1_info(paramType, infoName, infoType);
+      case 64:
+         return ANARI_GEOMETRY_sphere_primitive_attribute2_info(paramType, infoName, infoType);
+      case 65:
+         return ANARI_GEOMETRY_sphere_primitive_attribute3_info(paramType, infoName, infoType);
+      case 67:
+         return ANARI_GEOMETRY_sphere_primitive_id_info(paramType, infoName, infoType);
+      case 101:
+         return ANARI_GEOMETRY_sphere_vertex_position_info(paramType, infoName, infoType);
+      case 102:
+         return ANARI_GEOMETRY_sphere_vertex_radius_info(paramType, infoName, infoType);
+      case 99:
+         return ANARI_GEOMETRY_sphere_vertex_color_info(paramType, infoName, infoType);
+      case 94:
+         return ANARI_GEOMETRY_sphere_vertex_attribute0_info(paramType, infoName, infoType);
+      case 95:
+         return ANARI_GEOMETRY_sphere_vertex_attribute1_info(paramType, infoName, infoType);
+      case 96:
+         return ANARI_GEOMETRY_sphere_vertex_attribute2_info(paramType, infoName, infoType);
+      case 97:
+         return ANARI_GEOMETRY_sphere_vertex_attribute3_info(paramType, infoName, infoType);
+      case 68:
+         return ANARI_GEOMETRY_sphere_primitive_index_info(paramType, infoName, infoType);
+      case 71:
+         return ANARI_GEOMETRY_sphere_radius_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5831,16 +6786,9 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute2_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute2";
+            static const char *description = "optional object name";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
@@ -5852,7 +6800,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute2_info(ANARIDataType
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5863,16 +6811,9 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute3_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute3";
+            static const char *description = "uniform color";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
@@ -5884,7 +6825,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute3_info(ANARIDataType
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5895,16 +6836,9 @@ static const void * ANARI_GEOMETRY_triangle_primitive_index_info(ANARIDataType p
          }
       case 4: // description
          {
-            static const char *description = "index array";
+            static const char *description = "uniform attribute0";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32_VEC3, ANARI_UINT64_VEC3, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
@@ -5916,55 +6850,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_index_info(ANARIDataType p
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_GEOMETRY_triangle_name_info(paramType, infoName, infoType);
-      case 18:
-         return ANARI_GEOMETRY_triangle_color_info(paramType, infoName, infoType);
-      case 6:
-         return ANARI_GEOMETRY_triangle_attribute0_info(paramType, infoName, infoType);
-      case 7:
-         return ANARI_GEOMETRY_triangle_attribute1_info(paramType, infoName, infoType);
-      case 8:
-         return ANARI_GEOMETRY_triangle_attribute2_info(paramType, infoName, infoType);
-      case 9:
-         return ANARI_GEOMETRY_triangle_attribute3_info(paramType, infoName, infoType);
-      case 49:
-         return ANARI_GEOMETRY_triangle_primitive_color_info(paramType, infoName, infoType);
-      case 45:
-         return ANARI_GEOMETRY_triangle_primitive_attribute0_info(paramType, infoName, infoType);
-      case 46:
-         return ANARI_GEOMETRY_triangle_primitive_attribute1_info(paramType, infoName, infoType);
-      case 47:
-         return ANARI_GEOMETRY_triangle_primitive_attribute2_info(paramType, infoName, infoType);
-      case 48:
-         return ANARI_GEOMETRY_triangle_primitive_attribute3_info(paramType, infoName, infoType);
-      case 50:
-         return ANARI_GEOMETRY_triangle_primitive_id_info(paramType, infoName, infoType);
-      case 72:
-         return ANARI_GEOMETRY_triangle_vertex_position_info(paramType, infoName, infoType);
-      case 71:
-         return ANARI_GEOMETRY_triangle_vertex_normal_info(paramType, infoName, infoType);
-      case 74:
-         return ANARI_GEOMETRY_triangle_vertex_tangent_info(paramType, infoName, infoType);
-      case 70:
-         return ANARI_GEOMETRY_triangle_vertex_color_info(paramType, infoName, infoType);
-      case 65:
-         return ANARI_GEOMETRY_triangle_vertex_attribute0_info(paramType, infoName, infoType);
-      case 66:
-         return ANARI_GEOMETRY_triangle_vertex_attribute1_info(paramType, infoName, infoType);
-      case 67:
-         return ANARI_GEOMETRY_triangle_vertex_attribute2_info(paramType, infoName, infoType);
-      case 68:
-         return ANARI_GEOMETRY_triangle_vertex_attribute3_info(paramType, infoName, infoType);
-      case 51:
-         return ANARI_GEOMETRY_triangle_primitive_index_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_MATERIAL_matte_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5975,21 +6861,21 @@ static const void * ANARI_MATERIAL_matte_name_info(ANARIDataType paramType, int
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "uniform attribute1";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_MATERIAL_MATTE";
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_MATERIAL_matte_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5998,43 +6884,23 @@ static const void * ANARI_MATERIAL_matte_color_info(ANARIDataType paramType, int
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {0.800000f, 0.800000f, 0.800000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
-      case 11: // use
-         if(infoType == ANARI_STRING) {
-            return "color";
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "diffuse color";
+            static const char *description = "uniform attribute2";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_MATERIAL_MATTE";
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_MATERIAL_matte_opacity_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6043,37 +6909,23 @@ static const void * ANARI_MATERIAL_matte_opacity_info(ANARIDataType paramType, i
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
-            static const float default_value[1] = {1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "opacity";
+            static const char *description = "uniform attribute3";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_MATERIAL_MATTE";
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_MATERIAL_matte_alphaMode_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6082,37 +6934,30 @@ static const void * ANARI_MATERIAL_matte_alphaMode_info(ANARIDataType paramType,
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "opaque";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "alpha mode";
+            static const char *description = "per primitive color";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"opaque", "blend", "mask", nullptr};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_MATERIAL_MATTE";
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_MATERIAL_matte_alphaCutoff_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6121,46 +6966,30 @@ static const void * ANARI_MATERIAL_matte_alphaCutoff_info(ANARIDataType paramTyp
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
-            static const float default_value[1] = {0.500000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "cutoff for alpha mask mode";
+            static const char *description = "per primitive attribute0";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_MATERIAL_MATTE";
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_MATERIAL_matte_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_MATERIAL_matte_name_info(paramType, infoName, infoType);
-      case 18:
-         return ANARI_MATERIAL_matte_color_info(paramType, infoName, infoType);
-      case 40:
-         return ANARI_MATERIAL_matte_opacity_info(paramType, infoName, infoType);
-      case 2:
-         return ANARI_MATERIAL_matte_alphaMode_info(paramType, infoName, infoType);
-      case 1:
-         return ANARI_MATERIAL_matte_alphaCutoff_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_SAMPLER_image1D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6171,53 +7000,60 @@ static const void * ANARI_SAMPLER_image1D_name_info(ANARIDataType paramType, int
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "per primitive attribute1";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image1D_image_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "array backing the sampler";
+            static const char *description = "per primitive attribute2";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image1D_inAttribute_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6226,37 +7062,30 @@ static const void * ANARI_SAMPLER_image1D_inAttribute_info(ANARIDataType paramTy
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "attribute0";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "input surface attribute (texture coordinate)";
+            static const char *description = "per primitive attribute3";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image1D_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6265,76 +7094,62 @@ static const void * ANARI_SAMPLER_image1D_filter_info(ANARIDataType paramType, i
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "nearest";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "filter mode";
+            static const char *description = "primitive id";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"nearest", "linear", nullptr};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UINT64, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image1D_wrapMode1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
-         } else {
-            return nullptr;
-         }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "clampToEdge";
-            return default_value;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "wrap mode for the 1st dimension";
+            static const char *description = "vertex position";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image1D_inTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_vertex_normal_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6343,30 +7158,30 @@ static const void * ANARI_SAMPLER_image1D_inTransform_info(ANARIDataType paramTy
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
-            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "transform applied to the input attribute before sampling";
+            static const char *description = "vertex normal";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_FIXED16_VEC3, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image1D_inOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_vertex_tangent_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6375,30 +7190,30 @@ static const void * ANARI_SAMPLER_image1D_inOffset_info(ANARIDataType paramType,
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
-            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "offset added to output inTransform result";
+            static const char *description = "vertex normal";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_FIXED16_VEC3, ANARI_FLOAT32_VEC4, ANARI_FIXED16_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image1D_outTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6407,30 +7222,30 @@ static const void * ANARI_SAMPLER_image1D_outTransform_info(ANARIDataType paramT
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
-            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "transform applied to the sampled values";
+            static const char *description = "vertex color";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image1D_outOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6439,54 +7254,30 @@ static const void * ANARI_SAMPLER_image1D_outOffset_info(ANARIDataType paramType
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
-            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "offset added to output outTransform result";
+            static const char *description = "vertex attribute0";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_SAMPLER_image1D_name_info(paramType, infoName, infoType);
-      case 28:
-         return ANARI_SAMPLER_image1D_image_info(paramType, infoName, infoType);
-      case 30:
-         return ANARI_SAMPLER_image1D_inAttribute_info(paramType, infoName, infoType);
-      case 22:
-         return ANARI_SAMPLER_image1D_filter_info(paramType, infoName, infoType);
-      case 77:
-         return ANARI_SAMPLER_image1D_wrapMode1_info(paramType, infoName, infoType);
-      case 32:
-         return ANARI_SAMPLER_image1D_inTransform_info(paramType, infoName, infoType);
-      case 31:
-         return ANARI_SAMPLER_image1D_inOffset_info(paramType, infoName, infoType);
-      case 43:
-         return ANARI_SAMPLER_image1D_outTransform_info(paramType, infoName, infoType);
-      case 42:
-         return ANARI_SAMPLER_image1D_outOffset_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_SAMPLER_image2D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6497,53 +7288,60 @@ static const void * ANARI_SAMPLER_image2D_name_info(ANARIDataType paramType, int
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "vertex attribute1";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image2D_image_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "array backing the sampler";
+            static const char *description = "vertex attribute2";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image2D_inAttribute_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6552,37 +7350,30 @@ static const void * ANARI_SAMPLER_image2D_inAttribute_info(ANARIDataType paramTy
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "attribute0";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "input surface attribute (texture coordinate)";
+            static const char *description = "vertex attribute3";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image2D_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6591,37 +7382,78 @@ static const void * ANARI_SAMPLER_image2D_filter_info(ANARIDataType paramType, i
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "nearest";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "filter mode";
+            static const char *description = "index array";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"nearest", "linear", nullptr};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32_VEC3, ANARI_UINT64_VEC3, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image2D_wrapMode1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 55:
+         return ANARI_GEOMETRY_triangle_name_info(paramType, infoName, infoType);
+      case 18:
+         return ANARI_GEOMETRY_triangle_color_info(paramType, infoName, infoType);
+      case 6:
+         return ANARI_GEOMETRY_triangle_attribute0_info(paramType, infoName, infoType);
+      case 7:
+         return ANARI_GEOMETRY_triangle_attribute1_info(paramType, infoName, infoType);
+      case 8:
+         return ANARI_GEOMETRY_triangle_attribute2_info(paramType, infoName, infoType);
+      case 9:
+         return ANARI_GEOMETRY_triangle_attribute3_info(paramType, infoName, infoType);
+      case 66:
+         return ANARI_GEOMETRY_triangle_primitive_color_info(paramType, infoName, infoType);
+      case 62:
+         return ANARI_GEOMETRY_triangle_primitive_attribute0_info(paramType, infoName, infoType);
+      case 63:
+         return ANARI_GEOMETRY_triangle_primitive_attribute1_info(paramType, infoName, infoType);
+      case 64:
+         return ANARI_GEOMETRY_triangle_primitive_attribute2_info(paramType, infoName, infoType);
+      case 65:
+         return ANARI_GEOMETRY_triangle_primitive_attribute3_info(paramType, infoName, infoType);
+      case 67:
+         return ANARI_GEOMETRY_triangle_primitive_id_info(paramType, infoName, infoType);
+      case 101:
+         return ANARI_GEOMETRY_triangle_vertex_position_info(paramType, infoName, infoType);
+      case 100:
+         return ANARI_GEOMETRY_triangle_vertex_normal_info(paramType, infoName, infoType);
+      case 103:
+         return ANARI_GEOMETRY_triangle_vertex_tangent_info(paramType, infoName, infoType);
+      case 99:
+         return ANARI_GEOMETRY_triangle_vertex_color_info(paramType, infoName, infoType);
+      case 94:
+         return ANARI_GEOMETRY_triangle_vertex_attribute0_info(paramType, infoName, infoType);
+      case 95:
+         return ANARI_GEOMETRY_triangle_vertex_attribute1_info(paramType, infoName, infoType);
+      case 96:
+         return ANARI_GEOMETRY_triangle_vertex_attribute2_info(paramType, infoName, infoType);
+      case 97:
+         return ANARI_GEOMETRY_triangle_vertex_attribute3_info(paramType, infoName, infoType);
+      case 68:
+         return ANARI_GEOMETRY_triangle_primitive_index_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_matte_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6630,37 +7462,23 @@ static const void * ANARI_SAMPLER_image2D_wrapMode1_info(ANARIDataType paramType
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "clampToEdge";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "wrap mode for the 1st dimension";
+            static const char *description = "optional object name";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            static const char *extension = "KHR_MATERIAL_MATTE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image2D_wrapMode2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_MATERIAL_matte_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6670,36 +7488,42 @@ static const void * ANARI_SAMPLER_image2D_wrapMode2_info(ANARIDataType paramType
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "clampToEdge";
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.800000f, 0.800000f, 0.800000f};
             return default_value;
          } else {
             return nullptr;
          }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "color";
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "wrap mode for the 2nd dimension";
+            static const char *description = "diffuse color";
             return description;
          }
       case 6: // value
          if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            static const char *extension = "KHR_MATERIAL_MATTE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image2D_inTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_MATERIAL_matte_opacity_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6709,61 +7533,36 @@ static const void * ANARI_SAMPLER_image2D_inTransform_info(ANARIDataType paramTy
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
-            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "transform applied to the input attribute before sampling";
+            static const char *description = "opacity";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
-            return &value;
-         }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_SAMPLER_image2D_inOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   (void)paramType;
-   switch(infoName) {
-      case 0: // required
-         if(infoType == ANARI_BOOL) {
-            return &anari_false;
-         } else {
-            return nullptr;
-         }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
-            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
-            return default_value;
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
          } else {
             return nullptr;
          }
-      case 4: // description
-         {
-            static const char *description = "offset added to output inTransform result";
-            return description;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            static const char *extension = "KHR_MATERIAL_MATTE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image2D_outTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_MATERIAL_matte_alphaMode_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6773,29 +7572,36 @@ static const void * ANARI_SAMPLER_image2D_outTransform_info(ANARIDataType paramT
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
-            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "opaque";
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "transform applied to the sampled values";
+            static const char *description = "alpha mode";
             return description;
          }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"opaque", "blend", "mask", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            static const char *extension = "KHR_MATERIAL_MATTE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image2D_outOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_MATERIAL_matte_alphaCutoff_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6805,55 +7611,45 @@ static const void * ANARI_SAMPLER_image2D_outOffset_info(ANARIDataType paramType
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
-            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.500000f};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "offset added to output outTransform result";
+            static const char *description = "cutoff for alpha mask mode";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            static const char *extension = "KHR_MATERIAL_MATTE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image2D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_MATERIAL_matte_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_SAMPLER_image2D_name_info(paramType, infoName, infoType);
-      case 28:
-         return ANARI_SAMPLER_image2D_image_info(paramType, infoName, infoType);
-      case 30:
-         return ANARI_SAMPLER_image2D_inAttribute_info(paramType, infoName, infoType);
-      case 22:
-         return ANARI_SAMPLER_image2D_filter_info(paramType, infoName, infoType);
-      case 77:
-         return ANARI_SAMPLER_image2D_wrapMode1_info(paramType, infoName, infoType);
-      case 78:
-         return ANARI_SAMPLER_image2D_wrapMode2_info(paramType, infoName, infoType);
-      case 32:
-         return ANARI_SAMPLER_image2D_inTransform_info(paramType, infoName, infoType);
-      case 31:
-         return ANARI_SAMPLER_image2D_inOffset_info(paramType, infoName, infoType);
-      case 43:
-         return ANARI_SAMPLER_image2D_outTransform_info(paramType, infoName, infoType);
-      case 42:
-         return ANARI_SAMPLER_image2D_outOffset_info(paramType, infoName, infoType);
+      case 55:
+         return ANARI_MATERIAL_matte_name_info(paramType, infoName, infoType);
+      case 18:
+         return ANARI_MATERIAL_matte_color_info(paramType, infoName, infoType);
+      case 57:
+         return ANARI_MATERIAL_matte_opacity_info(paramType, infoName, infoType);
+      case 2:
+         return ANARI_MATERIAL_matte_alphaMode_info(paramType, infoName, infoType);
+      case 1:
+         return ANARI_MATERIAL_matte_alphaCutoff_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image1D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6869,16 +7665,16 @@ static const void * ANARI_SAMPLER_image3D_name_info(ANARIDataType paramType, int
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE3D";
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 16;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_image_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image1D_image_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6901,16 +7697,16 @@ static const void * ANARI_SAMPLER_image3D_image_info(ANARIDataType paramType, in
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE3D";
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 16;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_inAttribute_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image1D_inAttribute_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6940,16 +7736,16 @@ static const void * ANARI_SAMPLER_image3D_inAttribute_info(ANARIDataType paramTy
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE3D";
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 16;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image1D_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6979,16 +7775,16 @@ static const void * ANARI_SAMPLER_image3D_filter_info(ANARIDataType paramType, i
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE3D";
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 16;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_wrapMode1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image1D_wrapMode1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7018,16 +7814,16 @@ static const void * ANARI_SAMPLER_image3D_wrapMode1_info(ANARIDataType paramType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE3D";
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 16;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_wrapMode2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image1D_inTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7037,36 +7833,93 @@ static const void * ANARI_SAMPLER_image3D_wrapMode2_info(ANARIDataType paramType
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "clampToEdge";
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "wrap mode for the 2nd dimension";
+            static const char *description = "transform applied to the input attribute before sampling";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
-            return values;
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 14;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image1D_inOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "offset added to output inTransform result";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 14;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image1D_outTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
          } else {
             return nullptr;
          }
+      case 4: // description
+         {
+            static const char *description = "transform applied to the sampled values";
+            return description;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE3D";
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 16;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_wrapMode3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image1D_outOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7076,36 +7929,53 @@ static const void * ANARI_SAMPLER_image3D_wrapMode3_info(ANARIDataType paramType
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "clampToEdge";
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "wrap mode for the 3rd dimension";
+            static const char *description = "offset added to output outTransform result";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE3D";
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 16;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_inTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 55:
+         return ANARI_SAMPLER_image1D_name_info(paramType, infoName, infoType);
+      case 39:
+         return ANARI_SAMPLER_image1D_image_info(paramType, infoName, infoType);
+      case 43:
+         return ANARI_SAMPLER_image1D_inAttribute_info(paramType, infoName, infoType);
+      case 29:
+         return ANARI_SAMPLER_image1D_filter_info(paramType, infoName, infoType);
+      case 108:
+         return ANARI_SAMPLER_image1D_wrapMode1_info(paramType, infoName, infoType);
+      case 45:
+         return ANARI_SAMPLER_image1D_inTransform_info(paramType, infoName, infoType);
+      case 44:
+         return ANARI_SAMPLER_image1D_inOffset_info(paramType, infoName, infoType);
+      case 60:
+         return ANARI_SAMPLER_image1D_outTransform_info(paramType, infoName, infoType);
+      case 59:
+         return ANARI_SAMPLER_image1D_outOffset_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image3D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7114,16 +7984,9 @@ static const void * ANARI_SAMPLER_image3D_inTransform_info(ANARIDataType paramTy
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
-            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "transform applied to the input attribute before sampling";
+            static const char *description = "optional object name";
             return description;
          }
       case 7: // sourceExtension
@@ -7137,27 +8000,27 @@ static const void * ANARI_SAMPLER_image3D_inTransform_info(ANARIDataType paramTy
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_inOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_image_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
-         } else {
-            return nullptr;
-         }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
-            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
-            return default_value;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "offset added to output inTransform result";
+            static const char *description = "array backing the sampler";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
             static const char *extension = "KHR_SAMPLER_IMAGE3D";
@@ -7169,7 +8032,7 @@ static const void * ANARI_SAMPLER_image3D_inOffset_info(ANARIDataType paramType,
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_outTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_inAttribute_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7179,17 +8042,24 @@ static const void * ANARI_SAMPLER_image3D_outTransform_info(ANARIDataType paramT
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
-            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "attribute0";
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "transform applied to the sampled values";
+            static const char *description = "input surface attribute (texture coordinate)";
             return description;
          }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
             static const char *extension = "KHR_SAMPLER_IMAGE3D";
@@ -7201,7 +8071,7 @@ static const void * ANARI_SAMPLER_image3D_outTransform_info(ANARIDataType paramT
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_outOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7211,17 +8081,24 @@ static const void * ANARI_SAMPLER_image3D_outOffset_info(ANARIDataType paramType
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
-            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "nearest";
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "offset added to output outTransform result";
+            static const char *description = "filter mode";
             return description;
          }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"nearest", "linear", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
             static const char *extension = "KHR_SAMPLER_IMAGE3D";
@@ -7233,35 +8110,7 @@ static const void * ANARI_SAMPLER_image3D_outOffset_info(ANARIDataType paramType
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_SAMPLER_image3D_name_info(paramType, infoName, infoType);
-      case 28:
-         return ANARI_SAMPLER_image3D_image_info(paramType, infoName, infoType);
-      case 30:
-         return ANARI_SAMPLER_image3D_inAttribute_info(paramType, infoName, infoType);
-      case 22:
-         return ANARI_SAMPLER_image3D_filter_info(paramType, infoName, infoType);
-      case 77:
-         return ANARI_SAMPLER_image3D_wrapMode1_info(paramType, infoName, infoType);
-      case 78:
-         return ANARI_SAMPLER_image3D_wrapMode2_info(paramType, infoName, infoType);
-      case 79:
-         return ANARI_SAMPLER_image3D_wrapMode3_info(paramType, infoName, infoType);
-      case 32:
-         return ANARI_SAMPLER_image3D_inTransform_info(paramType, infoName, infoType);
-      case 31:
-         return ANARI_SAMPLER_image3D_inOffset_info(paramType, infoName, infoType);
-      case 43:
-         return ANARI_SAMPLER_image3D_outTransform_info(paramType, infoName, infoType);
-      case 42:
-         return ANARI_SAMPLER_image3D_outOffset_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_SAMPLER_primitive_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_wrapMode1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7270,55 +8119,76 @@ static const void * ANARI_SAMPLER_primitive_name_info(ANARIDataType paramType, i
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "clampToEdge";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "wrap mode for the 1st dimension";
             return description;
          }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_PRIMITIVE";
+            static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 17;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_primitive_array_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_wrapMode2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "clampToEdge";
+            return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "backing array of the sampler";
+            static const char *description = "wrap mode for the 2nd dimension";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_PRIMITIVE";
+            static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 17;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_primitive_inOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_wrapMode3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7328,41 +8198,36 @@ static const void * ANARI_SAMPLER_primitive_inOffset_info(ANARIDataType paramTyp
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_UINT64 && infoType == ANARI_UINT64) {
-            static const uint64_t default_value[1] = {UINT64_C(0)};
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "clampToEdge";
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "offset added to primitiveId";
+            static const char *description = "wrap mode for the 3rd dimension";
             return description;
          }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_PRIMITIVE";
+            static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 17;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_primitive_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_SAMPLER_primitive_name_info(paramType, infoName, infoType);
-      case 4:
-         return ANARI_SAMPLER_primitive_array_info(paramType, infoName, infoType);
-      case 31:
-         return ANARI_SAMPLER_primitive_inOffset_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_SAMPLER_transform_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_inTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7371,23 +8236,30 @@ static const void * ANARI_SAMPLER_transform_name_info(ANARIDataType paramType, i
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "transform applied to the input attribute before sampling";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_TRANSFORM";
+            static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_transform_inAttribute_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_inOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7397,36 +8269,29 @@ static const void * ANARI_SAMPLER_transform_inAttribute_info(ANARIDataType param
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "attribute0";
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "input surface attribute (texture coordinate)";
+            static const char *description = "offset added to output inTransform result";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_TRANSFORM";
+            static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_transform_outTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_outTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7444,21 +8309,21 @@ static const void * ANARI_SAMPLER_transform_outTransform_info(ANARIDataType para
          }
       case 4: // description
          {
-            static const char *description = "transform applied to the input attribute";
+            static const char *description = "transform applied to the sampled values";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_TRANSFORM";
+            static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_transform_outOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_outOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7481,30 +8346,44 @@ static const void * ANARI_SAMPLER_transform_outOffset_info(ANARIDataType paramTy
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_TRANSFORM";
+            static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_transform_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_SAMPLER_transform_name_info(paramType, infoName, infoType);
-      case 30:
-         return ANARI_SAMPLER_transform_inAttribute_info(paramType, infoName, infoType);
+      case 55:
+         return ANARI_SAMPLER_image3D_name_info(paramType, infoName, infoType);
+      case 39:
+         return ANARI_SAMPLER_image3D_image_info(paramType, infoName, infoType);
       case 43:
-         return ANARI_SAMPLER_transform_outTransform_info(paramType, infoName, infoType);
-      case 42:
-         return ANARI_SAMPLER_transform_outOffset_info(paramType, infoName, infoType);
+         return ANARI_SAMPLER_image3D_inAttribute_info(paramType, infoName, infoType);
+      case 29:
+         return ANARI_SAMPLER_image3D_filter_info(paramType, infoName, infoType);
+      case 108:
+         return ANARI_SAMPLER_image3D_wrapMode1_info(paramType, infoName, infoType);
+      case 109:
+         return ANARI_SAMPLER_image3D_wrapMode2_info(paramType, infoName, infoType);
+      case 110:
+         return ANARI_SAMPLER_image3D_wrapMode3_info(paramType, infoName, infoType);
+      case 45:
+         return ANARI_SAMPLER_image3D_inTransform_info(paramType, infoName, infoType);
+      case 44:
+         return ANARI_SAMPLER_image3D_inOffset_info(paramType, infoName, infoType);
+      case 60:
+         return ANARI_SAMPLER_image3D_outTransform_info(paramType, infoName, infoType);
+      case 59:
+         return ANARI_SAMPLER_image3D_outOffset_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_primitive_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7520,16 +8399,16 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_name_info(ANARIDataTyp
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            static const char *extension = "KHR_SAMPLER_PRIMITIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_data_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_primitive_array_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7540,28 +8419,28 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_data_info(ANARIDataTyp
          }
       case 4: // description
          {
-            static const char *description = "array of vertex centered scalar values";
+            static const char *description = "backing array of the sampler";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT8, ANARI_INT16, ANARI_UINT16, ANARI_FLOAT32, ANARI_FLOAT64, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            static const char *extension = "KHR_SAMPLER_PRIMITIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_origin_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_primitive_inOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7571,29 +8450,66 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_origin_info(ANARIDataT
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
+         if(paramType == ANARI_UINT64 && infoType == ANARI_UINT64) {
+            static const uint64_t default_value[1] = {UINT64_C(0)};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "origin of the grid in object-space";
+            static const char *description = "offset added to primitiveId";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            static const char *extension = "KHR_SAMPLER_PRIMITIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_primitive_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 55:
+         return ANARI_SAMPLER_primitive_name_info(paramType, infoName, infoType);
+      case 4:
+         return ANARI_SAMPLER_primitive_array_info(paramType, infoName, infoType);
+      case 44:
+         return ANARI_SAMPLER_primitive_inOffset_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_transform_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_TRANSFORM";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_transform_inAttribute_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7603,29 +8519,36 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(ANARIData
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {1.000000f, 1.000000f, 1.000000f};
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "attribute0";
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "size of the grid cells in object-space";
+            static const char *description = "input surface attribute (texture coordinate)";
             return description;
          }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            static const char *extension = "KHR_SAMPLER_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 18;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_transform_outTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7635,47 +8558,70 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_filter_info(ANARIDataT
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "linear";
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "filter mode used to interpolate the grid";
+            static const char *description = "transform applied to the input attribute";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"nearest", "linear", nullptr};
-            return values;
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_TRANSFORM";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_transform_outOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
+            return default_value;
          } else {
             return nullptr;
          }
+      case 4: // description
+         {
+            static const char *description = "offset added to output outTransform result";
+            return description;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            static const char *extension = "KHR_SAMPLER_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 18;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_transform_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 38:
-         return ANARI_SPATIAL_FIELD_structuredRegular_name_info(paramType, infoName, infoType);
-      case 19:
-         return ANARI_SPATIAL_FIELD_structuredRegular_data_info(paramType, infoName, infoType);
-      case 41:
-         return ANARI_SPATIAL_FIELD_structuredRegular_origin_info(paramType, infoName, infoType);
-      case 56:
-         return ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(paramType, infoName, infoType);
-      case 22:
-         return ANARI_SPATIAL_FIELD_structuredRegular_filter_info(paramType, infoName, infoType);
+      case 55:
+         return ANARI_SAMPLER_transform_name_info(paramType, infoName, infoType);
+      case 43:
+         return ANARI_SAMPLER_transform_inAttribute_info(paramType, infoName, infoType);
+      case 60:
+         return ANARI_SAMPLER_transform_outTransform_info(paramType, infoName, infoType);
+      case 59:
+         return ANARI_SAMPLER_transform_outOffset_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
@@ -7860,17 +8806,17 @@ static const void * ANARI_VOLUME_transferFunction1D_unitDistance_info(ANARIDataT
 }
 static const void * ANARI_VOLUME_transferFunction1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 38:
+      case 55:
          return ANARI_VOLUME_transferFunction1D_name_info(paramType, infoName, infoType);
-      case 63:
+      case 92:
          return ANARI_VOLUME_transferFunction1D_value_info(paramType, infoName, infoType);
-      case 64:
+      case 93:
          return ANARI_VOLUME_transferFunction1D_valueRange_info(paramType, infoName, infoType);
       case 18:
          return ANARI_VOLUME_transferFunction1D_color_info(paramType, infoName, infoType);
-      case 40:
+      case 57:
          return ANARI_VOLUME_transferFunction1D_opacity_info(paramType, infoName, infoType);
-      case 61:
+      case 90:
          return ANARI_VOLUME_transferFunction1D_unitDistance_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -7878,10 +8824,10 @@ static const void * ANARI_VOLUME_transferFunction1D_param_info(const char *param
 }
 static const void * ANARI_CAMERA_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 9:
-         return ANARI_CAMERA_orthographic_param_info(paramName, paramType, infoName, infoType);
-      case 10:
+      case 11:
          return ANARI_CAMERA_perspective_param_info(paramName, paramType, infoName, infoType);
+      case 10:
+         return ANARI_CAMERA_orthographic_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
    }
@@ -7894,11 +8840,11 @@ static const void * ANARI_GEOMETRY_param_info(const char *subtype, const char *p
          return ANARI_GEOMETRY_curve_param_info(paramName, paramType, infoName, infoType);
       case 3:
          return ANARI_GEOMETRY_cylinder_param_info(paramName, paramType, infoName, infoType);
-      case 12:
-         return ANARI_GEOMETRY_quad_param_info(paramName, paramType, infoName, infoType);
       case 13:
+         return ANARI_GEOMETRY_quad_param_info(paramName, paramType, infoName, infoType);
+      case 14:
          return ANARI_GEOMETRY_sphere_param_info(paramName, paramType, infoName, infoType);
-      case 17:
+      case 18:
          return ANARI_GEOMETRY_triangle_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
@@ -7906,7 +8852,9 @@ static const void * ANARI_GEOMETRY_param_info(const char *subtype, const char *p
 }
 static const void * ANARI_INSTANCE_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 16:
+      case 8:
+         return ANARI_INSTANCE_lod_param_info(paramName, paramType, infoName, infoType);
+      case 17:
          return ANARI_INSTANCE_transform_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
@@ -7914,7 +8862,7 @@ static const void * ANARI_INSTANCE_param_info(const char *subtype, const char *p
 }
 static const void * ANARI_MATERIAL_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 8:
+      case 9:
          return ANARI_MATERIAL_matte_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
@@ -7930,15 +8878,15 @@ static const void * ANARI_RENDERER_param_info(const char *subtype, const char *p
 }
 static const void * ANARI_SAMPLER_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 5:
-         return ANARI_SAMPLER_image1D_param_info(paramName, paramType, infoName, infoType);
       case 6:
          return ANARI_SAMPLER_image2D_param_info(paramName, paramType, infoName, infoType);
+      case 5:
+         return ANARI_SAMPLER_image1D_param_info(paramName, paramType, infoName, infoType);
       case 7:
          return ANARI_SAMPLER_image3D_param_info(paramName, paramType, infoName, infoType);
-      case 11:
+      case 12:
          return ANARI_SAMPLER_primitive_param_info(paramName, paramType, infoName, infoType);
-      case 16:
+      case 17:
          return ANARI_SAMPLER_transform_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
@@ -7946,7 +8894,7 @@ static const void * ANARI_SAMPLER_param_info(const char *subtype, const char *pa
 }
 static const void * ANARI_SPATIAL_FIELD_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 14:
+      case 15:
          return ANARI_SPATIAL_FIELD_structuredRegular_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
@@ -7956,7 +8904,7 @@ static const void * ANARI_VOLUME_param_info(const char *subtype, const char *par
    switch(subtype_hash(subtype)) {
       case 0:
          return ANARI_VOLUME__param_info(paramName, paramType, infoName, infoType);
-      case 15:
+      case 16:
          return ANARI_VOLUME_transferFunction1D_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
@@ -7982,14 +8930,14 @@ const void * query_param_info_enum(ANARIDataType type, const char *subtype, cons
          return ANARI_VOLUME_param_info(subtype, paramName, paramType, infoName, infoType);
       case ANARI_DEVICE:
          return ANARI_DEVICE_param_info(paramName, paramType, infoName, infoType);
+      case ANARI_FRAME:
+         return ANARI_FRAME_param_info(paramName, paramType, infoName, infoType);
       case ANARI_ARRAY1D:
          return ANARI_ARRAY1D_param_info(paramName, paramType, infoName, infoType);
       case ANARI_ARRAY2D:
          return ANARI_ARRAY2D_param_info(paramName, paramType, infoName, infoType);
       case ANARI_ARRAY3D:
          return ANARI_ARRAY3D_param_info(paramName, paramType, infoName, infoType);
-      case ANARI_FRAME:
-         return ANARI_FRAME_param_info(paramName, paramType, infoName, infoType);
       case ANARI_GROUP:
          return ANARI_GROUP_param_info(paramName, paramType, infoName, infoType);
       case ANARI_WORLD:
@@ -8016,6 +8964,8 @@ static const void * ANARI_DEVICE_info(int infoName, ANARIDataType infoType) {
             static const ANARIParameter parameters[] = {
                {"allowInvalidMaterials", ANARI_BOOL},
                {"invalidMaterialColor", ANARI_FLOAT32_VEC4},
+               {"eagerBVHBuild", ANARI_BOOL},
+               {"deferredReclamation", ANARI_BOOL},
                {"name", ANARI_STRING},
                {"statusCallback", ANARI_STATUS_CALLBACK},
                {"statusCallbackUserData", ANARI_VOID_POINTER},
@@ -8111,17 +9061,66 @@ static const void * ANARI_RENDERER_default_info(int infoName, ANARIDataType info
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY1D_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "image2D object";
+            return description;
+         }
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"tileCallback", ANARI_FUNCTION_POINTER},
+               {"tileCallbackUserData", ANARI_VOID_POINTER},
+               {"filename", ANARI_STRING},
+               {"fileOffset", ANARI_UINT64},
+               {"imageSize", ANARI_UINT32_VEC2},
+               {"imageFormat", ANARI_DATA_TYPE},
+               {"tileSize", ANARI_UINT32},
+               {"tileCacheSize", ANARI_UINT64},
+               {"name", ANARI_STRING},
+               {"image", ANARI_ARRAY2D},
+               {"inAttribute", ANARI_STRING},
+               {"filter", ANARI_STRING},
+               {"wrapMode1", ANARI_STRING},
+               {"wrapMode2", ANARI_STRING},
+               {"inTransform", ANARI_FLOAT32_MAT4},
+               {"inOffset", ANARI_FLOAT32_VEC4},
+               {"outTransform", ANARI_FLOAT32_MAT4},
+               {"outOffset", ANARI_FLOAT32_VEC4},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_perspective_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "one dimensional array object";
+            static const char *description = "perspective camera object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
+               {"viewOffsets", ANARI_ARRAY1D},
+               {"viewColumns", ANARI_UINT32},
+               {"stereoMode", ANARI_STRING},
+               {"interpupillaryDistance", ANARI_FLOAT32},
                {"name", ANARI_STRING},
+               {"position", ANARI_FLOAT32_VEC3},
+               {"direction", ANARI_FLOAT32_VEC3},
+               {"up", ANARI_FLOAT32_VEC3},
+               {"imageRegion", ANARI_FLOAT32_BOX2},
+               {"fovy", ANARI_FLOAT32},
+               {"aspect", ANARI_FLOAT32},
+               {"near", ANARI_FLOAT32},
+               {"far", ANARI_FLOAT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8131,17 +9130,29 @@ static const void * ANARI_ARRAY1D_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY2D_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_orthographic_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "two dimensional array object";
+            static const char *description = "orthographic camera object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
+               {"viewOffsets", ANARI_ARRAY1D},
+               {"viewColumns", ANARI_UINT32},
+               {"stereoMode", ANARI_STRING},
+               {"interpupillaryDistance", ANARI_FLOAT32},
                {"name", ANARI_STRING},
+               {"position", ANARI_FLOAT32_VEC3},
+               {"direction", ANARI_FLOAT32_VEC3},
+               {"up", ANARI_FLOAT32_VEC3},
+               {"imageRegion", ANARI_FLOAT32_BOX2},
+               {"aspect", ANARI_FLOAT32},
+               {"height", ANARI_FLOAT32},
+               {"near", ANARI_FLOAT32},
+               {"far", ANARI_FLOAT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8151,17 +9162,18 @@ static const void * ANARI_ARRAY2D_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY3D_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_lod_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
-      case 4: // description
-         {
-            static const char *description = "three dimensional array object";
-            return description;
-         }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
-               {"name", ANARI_STRING},
+               {"group", ANARI_ARRAY1D},
+               {"transform", ANARI_FLOAT32_MAT4},
+               {"id", ANARI_UINT32},
+               {"id", ANARI_UINT32},
+               {"switchDistance", ANARI_ARRAY1D},
+               {"switchSize", ANARI_ARRAY1D},
+               {"hysteresis", ANARI_FLOAT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8181,6 +9193,17 @@ static const void * ANARI_FRAME_info(int infoName, ANARIDataType infoType) {
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
+               {"reprojection", ANARI_BOOL},
+               {"reprojectionRefresh", ANARI_FLOAT32},
+               {"fixationPoints", ANARI_ARRAY1D},
+               {"fovealRadius", ANARI_FLOAT32},
+               {"foveationFalloff", ANARI_FLOAT32},
+               {"shadingRate", ANARI_ARRAY2D},
+               {"denoise", ANARI_BOOL},
+               {"denoiseIterations", ANARI_UINT32},
+               {"denoiseColorPhi", ANARI_FLOAT32},
+               {"proxyPreview", ANARI_BOOL},
+               {"timeBudget", ANARI_FLOAT32},
                {"name", ANARI_STRING},
                {"world", ANARI_WORLD},
                {"renderer", ANARI_RENDERER},
@@ -8214,20 +9237,24 @@ static const void * ANARI_FRAME_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "group object";
+            static const char *description = "structured regular spatial field object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
+               {"levelOfDetail", ANARI_BOOL},
+               {"levelOfDetailBias", ANARI_FLOAT32},
+               {"levelOfDetailAsync", ANARI_BOOL},
                {"name", ANARI_STRING},
-               {"surface", ANARI_ARRAY1D},
-               {"volume", ANARI_ARRAY1D},
-               {"light", ANARI_ARRAY1D},
+               {"data", ANARI_ARRAY3D},
+               {"origin", ANARI_FLOAT32_VEC3},
+               {"spacing", ANARI_FLOAT32_VEC3},
+               {"filter", ANARI_STRING},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8237,21 +9264,17 @@ static const void * ANARI_GROUP_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_WORLD_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_ARRAY1D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "world object";
+            static const char *description = "one dimensional array object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"instance", ANARI_ARRAY1D},
-               {"surface", ANARI_ARRAY1D},
-               {"volume", ANARI_ARRAY1D},
-               {"light", ANARI_ARRAY1D},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8261,20 +9284,17 @@ static const void * ANARI_WORLD_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_SURFACE_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_ARRAY2D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "surface object";
+            static const char *description = "two dimensional array object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"geometry", ANARI_GEOMETRY},
-               {"material", ANARI_MATERIAL},
-               {"id", ANARI_UINT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8284,96 +9304,109 @@ static const void * ANARI_SURFACE_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_INSTANCE_transform_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_ARRAY3D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "instance object";
+            static const char *description = "three dimensional array object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"transform", ANARI_FLOAT32_MAT4},
-               {"group", ANARI_GROUP},
-               {"id", ANARI_UINT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
          } else {
             return nullptr;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_INSTANCE_TRANSFORM";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int value = 0;
-            return &value;
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GROUP_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "group object";
+            return description;
+         }
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"name", ANARI_STRING},
+               {"surface", ANARI_ARRAY1D},
+               {"volume", ANARI_ARRAY1D},
+               {"light", ANARI_ARRAY1D},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
          } else {
             return nullptr;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_WORLD_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "orthographic camera object";
+            static const char *description = "world object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"position", ANARI_FLOAT32_VEC3},
-               {"direction", ANARI_FLOAT32_VEC3},
-               {"up", ANARI_FLOAT32_VEC3},
-               {"imageRegion", ANARI_FLOAT32_BOX2},
-               {"aspect", ANARI_FLOAT32},
-               {"height", ANARI_FLOAT32},
-               {"near", ANARI_FLOAT32},
-               {"far", ANARI_FLOAT32},
+               {"instance", ANARI_ARRAY1D},
+               {"surface", ANARI_ARRAY1D},
+               {"volume", ANARI_ARRAY1D},
+               {"light", ANARI_ARRAY1D},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
          } else {
             return nullptr;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int value = 1;
-            return &value;
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SURFACE_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "surface object";
+            return description;
+         }
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"name", ANARI_STRING},
+               {"geometry", ANARI_GEOMETRY},
+               {"material", ANARI_MATERIAL},
+               {"id", ANARI_UINT32},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
          } else {
             return nullptr;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_transform_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "perspective camera object";
+            static const char *description = "instance object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"position", ANARI_FLOAT32_VEC3},
-               {"direction", ANARI_FLOAT32_VEC3},
-               {"up", ANARI_FLOAT32_VEC3},
-               {"imageRegion", ANARI_FLOAT32_BOX2},
-               {"fovy", ANARI_FLOAT32},
-               {"aspect", ANARI_FLOAT32},
-               {"near", ANARI_FLOAT32},
-               {"far", ANARI_FLOAT32},
+               {"transform", ANARI_FLOAT32_MAT4},
+               {"group", ANARI_GROUP},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8382,10 +9415,10 @@ static const void * ANARI_CAMERA_perspective_info(int infoName, ANARIDataType in
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            static const char *extension = "KHR_INSTANCE_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 2;
+            static const int value = 0;
             return &value;
          } else {
             return nullptr;
@@ -8797,45 +9830,6 @@ static const void * ANARI_SAMPLER_image1D_info(int infoName, ANARIDataType infoT
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image2D_info(int infoName, ANARIDataType infoType) {
-   switch(infoName) {
-      case 4: // description
-         {
-            static const char *description = "image2D object";
-            return description;
-         }
-      case 9: // parameter
-         if(infoType == ANARI_PARAMETER_LIST) {
-            static const ANARIParameter parameters[] = {
-               {"name", ANARI_STRING},
-               {"image", ANARI_ARRAY2D},
-               {"inAttribute", ANARI_STRING},
-               {"filter", ANARI_STRING},
-               {"wrapMode1", ANARI_STRING},
-               {"wrapMode2", ANARI_STRING},
-               {"inTransform", ANARI_FLOAT32_MAT4},
-               {"inOffset", ANARI_FLOAT32_VEC4},
-               {"outTransform", ANARI_FLOAT32_MAT4},
-               {"outOffset", ANARI_FLOAT32_VEC4},
-               {0, ANARI_UNKNOWN}
-            };
-            return parameters;
-         } else {
-            return nullptr;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int value = 15;
-            return &value;
-         } else {
-            return nullptr;
-         }
-      default: return nullptr;
-   }
-}
 static const void * ANARI_SAMPLER_image3D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
@@ -8941,40 +9935,6 @@ static const void * ANARI_SAMPLER_transform_info(int infoName, ANARIDataType inf
       default: return nullptr;
    }
 }
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_info(int infoName, ANARIDataType infoType) {
-   switch(infoName) {
-      case 4: // description
-         {
-            static const char *description = "structured regular spatial field object";
-            return description;
-         }
-      case 9: // parameter
-         if(infoType == ANARI_PARAMETER_LIST) {
-            static const ANARIParameter parameters[] = {
-               {"name", ANARI_STRING},
-               {"data", ANARI_ARRAY3D},
-               {"origin", ANARI_FLOAT32_VEC3},
-               {"spacing", ANARI_FLOAT32_VEC3},
-               {"filter", ANARI_STRING},
-               {0, ANARI_UNKNOWN}
-            };
-            return parameters;
-         } else {
-            return nullptr;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int value = 19;
-            return &value;
-         } else {
-            return nullptr;
-         }
-      default: return nullptr;
-   }
-}
 static const void * ANARI_VOLUME_transferFunction1D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
@@ -9016,10 +9976,10 @@ static const void * ANARI_VOLUME_transferFunction1D_info(int infoName, ANARIData
 }
 static const void * ANARI_CAMERA_info(const char *subtype, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 9:
-         return ANARI_CAMERA_orthographic_info(infoName, infoType);
-      case 10:
+      case 11:
          return ANARI_CAMERA_perspective_info(infoName, infoType);
+      case 10:
+         return ANARI_CAMERA_orthographic_info(infoName, infoType);
       default:
          return nullptr;
    }
@@ -9032,11 +9992,11 @@ static const void * ANARI_GEOMETRY_info(const char *subtype, int infoName, ANARI
          return ANARI_GEOMETRY_curve_info(infoName, infoType);
       case 3:
          return ANARI_GEOMETRY_cylinder_info(infoName, infoType);
-      case 12:
-         return ANARI_GEOMETRY_quad_info(infoName, infoType);
       case 13:
+         return ANARI_GEOMETRY_quad_info(infoName, infoType);
+      case 14:
          return ANARI_GEOMETRY_sphere_info(infoName, infoType);
-      case 17:
+      case 18:
          return ANARI_GEOMETRY_triangle_info(infoName, infoType);
       default:
          return nullptr;
@@ -9044,7 +10004,9 @@ static const void * ANARI_GEOMETRY_info(const char *subtype, int infoName, ANARI
 }
 static const void * ANARI_INSTANCE_info(const char *subtype, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 16:
+      case 8:
+         return ANARI_INSTANCE_lod_info(infoName, infoType);
+      case 17:
          return ANARI_INSTANCE_transform_info(infoName, infoType);
       default:
          return nullptr;
@@ -9052,7 +10014,7 @@ static const void * ANARI_INSTANCE_info(const char *subtype, int infoName, ANARI
 }
 static const void * ANARI_MATERIAL_info(const char *subtype, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 8:
+      case 9:
          return ANARI_MATERIAL_matte_info(infoName, infoType);
       default:
          return nullptr;
@@ -9068,15 +10030,15 @@ static const void * ANARI_RENDERER_info(const char *subtype, int infoName, ANARI
 }
 static const void * ANARI_SAMPLER_info(const char *subtype, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 5:
-         return ANARI_SAMPLER_image1D_info(infoName, infoType);
       case 6:
          return ANARI_SAMPLER_image2D_info(infoName, infoType);
+      case 5:
+         return ANARI_SAMPLER_image1D_info(infoName, infoType);
       case 7:
          return ANARI_SAMPLER_image3D_info(infoName, infoType);
-      case 11:
+      case 12:
          return ANARI_SAMPLER_primitive_info(infoName, infoType);
-      case 16:
+      case 17:
          return ANARI_SAMPLER_transform_info(infoName, infoType);
       default:
          return nullptr;
@@ -9084,7 +10046,7 @@ static const void * ANARI_SAMPLER_info(const char *subtype, int infoName, ANARID
 }
 static const void * ANARI_SPATIAL_FIELD_info(const char *subtype, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 14:
+      case 15:
          return ANARI_SPATIAL_FIELD_structuredRegular_info(infoName, infoType);
       default:
          return nullptr;
@@ -9094,7 +10056,7 @@ static const void * ANARI_VOLUME_info(const char *subtype, int infoName, ANARIDa
    switch(subtype_hash(subtype)) {
       case 0:
          return ANARI_VOLUME__info(infoName, infoType);
-      case 15:
+      case 16:
          return ANARI_VOLUME_transferFunction1D_info(infoName, infoType);
       default:
          return nullptr;
@@ -9120,14 +10082,14 @@ const void * query_object_info_enum(ANARIDataType type, const char *subtype, int
          return ANARI_VOLUME_info(subtype, infoName, infoType);
       case ANARI_DEVICE:
          return ANARI_DEVICE_info(infoName, infoType);
+      case ANARI_FRAME:
+         return ANARI_FRAME_info(infoName, infoType);
       case ANARI_ARRAY1D:
          return ANARI_ARRAY1D_info(infoName, infoType);
       case ANARI_ARRAY2D:
          return ANARI_ARRAY2D_info(infoName, infoType);
       case ANARI_ARRAY3D:
          return ANARI_ARRAY3D_info(infoName, infoType);
-      case ANARI_FRAME:
-         return ANARI_FRAME_info(infoName, infoType);
       case ANARI_GROUP:
          return ANARI_GROUP_info(infoName, infoType);
       case ANARI_WORLD:
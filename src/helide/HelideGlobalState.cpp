@@ -3,6 +3,10 @@
 
 #include "HelideGlobalState.h"
 #include "frame/Frame.h"
+#include "scene/Group.h"
+// std
+#include <algorithm>
+#include <chrono>
 
 namespace helide {
 
@@ -16,4 +20,80 @@ void HelideGlobalState::waitOnCurrentFrame() const
     currentFrame->wait();
 }
 
+void HelideGlobalState::bvhBuildStarted(bool prebuild)
+{
+  std::lock_guard<std::mutex> lock(bvhBuilds.mutex);
+  (prebuild ? bvhBuilds.prebuilds : bvhBuilds.pending)++;
+}
+
+void HelideGlobalState::bvhBuildFinished(float seconds, bool prebuild)
+{
+  std::lock_guard<std::mutex> lock(bvhBuilds.mutex);
+  (prebuild ? bvhBuilds.prebuilds : bvhBuilds.pending)--;
+  bvhBuilds.buildTime += seconds;
+  if (bvhBuilds.pending == 0 || bvhBuilds.prebuilds == 0)
+    bvhBuilds.finished.notify_all();
+}
+
+bool HelideGlobalState::bvhBuildsPending() const
+{
+  std::lock_guard<std::mutex> lock(bvhBuilds.mutex);
+  return bvhBuilds.pending != 0;
+}
+
+bool HelideGlobalState::bvhPrebuildsPending() const
+{
+  std::lock_guard<std::mutex> lock(bvhBuilds.mutex);
+  return bvhBuilds.prebuilds != 0;
+}
+
+void HelideGlobalState::waitOnBVHBuilds()
+{
+  std::unique_lock<std::mutex> lock(bvhBuilds.mutex);
+  if (bvhBuilds.pending == 0)
+    return;
+
+  auto start = std::chrono::steady_clock::now();
+  bvhBuilds.finished.wait(lock, [&]() { return bvhBuilds.pending == 0; });
+  auto end = std::chrono::steady_clock::now();
+  bvhBuilds.waitTime += std::chrono::duration<float>(end - start).count();
+}
+
+void HelideGlobalState::waitOnBVHPrebuilds()
+{
+  std::unique_lock<std::mutex> lock(bvhBuilds.mutex);
+  if (bvhBuilds.prebuilds == 0)
+    return;
+
+  auto start = std::chrono::steady_clock::now();
+  bvhBuilds.finished.wait(lock, [&]() { return bvhBuilds.prebuilds == 0; });
+  auto end = std::chrono::steady_clock::now();
+  bvhBuilds.waitTime += std::chrono::duration<float>(end - start).count();
+}
+
+void HelideGlobalState::registerGroup(Group *g)
+{
+  std::lock_guard<std::mutex> lock(bvhBuilds.groupsMutex);
+  bvhBuilds.groups.push_back(g);
+}
+
+void HelideGlobalState::unregisterGroup(Group *g)
+{
+  std::lock_guard<std::mutex> lock(bvhBuilds.groupsMutex);
+  auto &groups = bvhBuilds.groups;
+  groups.erase(std::remove(groups.begin(), groups.end(), g), groups.end());
+}
+
+void HelideGlobalState::scheduleStaleBVHBuilds()
+{
+  std::lock_guard<std::mutex> lock(bvhBuilds.groupsMutex);
+  // Groups still building are left to the next frame, so this never blocks.
+  // Groups without a BLS (e.g. released LOD levels) are not rebuilt.
+  for (auto *g : bvhBuilds.groups) {
+    if (g->embreeScene() && !g->embreeSceneBuildPending()
+        && !g->embreeSceneUpToDate())
+      g->embreeSceneConstructAsync();
+  }
+}
+
 } // namespace helide
\ No newline at end of file
@@ -9,10 +9,15 @@
 #include "helium/BaseGlobalDeviceState.h"
 // embree
 #include "embree3/rtcore.h"
+// std
+#include <condition_variable>
+#include <mutex>
+#include <vector>
 
 namespace helide {
 
 struct Frame;
+struct Group;
 
 struct HelideGlobalState : public helium::BaseGlobalDeviceState
 {
@@ -21,8 +26,14 @@ struct HelideGlobalState : public helium::BaseGlobalDeviceState
   struct ObjectUpdates
   {
     helium::TimeStamp lastBLSReconstructSceneRequest{0};
+    // surfaces (or device parameters) changed, so every group must rebuild
+    // its BLS, not just the ones which were committed
+    helium::TimeStamp lastBLSReconstructAllRequest{0};
     helium::TimeStamp lastBLSCommitSceneRequest{0};
     helium::TimeStamp lastTLSReconstructSceneRequest{0};
+    // any committed object other than cameras, which can change what a pixel
+    // looks like (used to invalidate temporally reprojected frames)
+    helium::TimeStamp lastSceneCommit{0};
   } objectUpdates;
 
   RenderingSemaphore renderingSemaphore;
@@ -33,14 +44,55 @@ struct HelideGlobalState : public helium::BaseGlobalDeviceState
   bool allowInvalidSurfaceMaterials{true};
   float4 invalidMaterialColor{1.f, 0.f, 1.f, 1.f};
 
+  // With 'eagerBVHBuild' set, groups build their BLS on a background thread as
+  // soon as they are committed instead of at the start of the next frame
+  struct BVHBuilds
+  {
+    bool eager{false};
+    uint32_t pending{0};
+    // LOD levels built ahead of being bound, which frames do not wait on
+    uint32_t prebuilds{0};
+    float buildTime{0.f}; // seconds spent building in the background
+    float waitTime{0.f}; // seconds spent blocked on builds still in flight
+    mutable std::mutex mutex;
+    std::condition_variable finished;
+    // live groups, so geometry commits can rebuild the BLSs they invalidate
+    std::vector<Group *> groups;
+    std::mutex groupsMutex;
+  } bvhBuilds;
+
   // Helper methods //
 
   HelideGlobalState(ANARIDevice d);
   void waitOnCurrentFrame() const;
+
+  void bvhBuildStarted(bool prebuild = false);
+  void bvhBuildFinished(float seconds, bool prebuild = false);
+  bool bvhBuildsPending() const;
+  bool bvhPrebuildsPending() const;
+  void waitOnBVHBuilds();
+  void waitOnBVHPrebuilds();
+
+  void registerGroup(Group *g);
+  void unregisterGroup(Group *g);
+  // Start background builds for stale groups not already being built
+  void scheduleStaleBVHBuilds();
 };
 
 // Helper functions/macros ////////////////////////////////////////////////////
 
+// Types of the objects a group's BLS is built from
+inline const std::vector<ANARIDataType> &blsSourceTypes()
+{
+  static const std::vector<ANARIDataType> types = {ANARI_ARRAY1D,
+      ANARI_ARRAY2D,
+      ANARI_ARRAY3D,
+      ANARI_GEOMETRY,
+      ANARI_SURFACE,
+      ANARI_GROUP};
+  return types;
+}
+
 inline HelideGlobalState *asHelideState(helium::BaseGlobalDeviceState *s)
 {
   return (HelideGlobalState *)s;
@@ -34,8 +34,38 @@ struct Ray
   unsigned int primID{RTC_INVALID_GEOMETRY_ID}; // primitive ID
   unsigned int geomID{RTC_INVALID_GEOMETRY_ID}; // geometry ID
   unsigned int instID{RTC_INVALID_GEOMETRY_ID}; // instance ID
+
+  // Footprint (not read by embree) //
+
+  float spreadWidth{0.f}; // pixel footprint width at the ray origin
+  float spreadAngle{0.f}; // footprint growth per unit distance along the ray
 };
 
+// Bounds helpers /////////////////////////////////////////////////////////////
+
+inline bool isEmpty(const box3 &b)
+{
+  return b.lower.x > b.upper.x || b.lower.y > b.upper.y
+      || b.lower.z > b.upper.z;
+}
+
+// Axis-aligned bounds of the box 'b' transformed by 'm'
+inline box3 xfmBox(const mat4 &m, const box3 &b)
+{
+  if (isEmpty(b))
+    return b;
+
+  box3 retval;
+  for (int i = 0; i < 8; i++) {
+    const float3 corner(i & 1 ? b.upper.x : b.lower.x,
+        i & 2 ? b.upper.y : b.lower.y,
+        i & 4 ? b.upper.z : b.lower.z);
+    const float4 p = linalg::mul(m, float4(corner, 1.f));
+    retval.extend(float3(p.x, p.y, p.z));
+  }
+  return retval;
+}
+
 struct Volume;
 struct VolumeRay
 {
@@ -44,6 +74,8 @@ struct VolumeRay
   box1 t{0.f, std::numeric_limits<float>::max()};
   Volume *volume{nullptr};
   uint32_t instID{RTC_INVALID_GEOMETRY_ID};
+  float spreadWidth{0.f};
+  float spreadAngle{0.f};
 };
 
 } // namespace helide
@@ -19,6 +19,13 @@ void Object::commit()
   // no-op
 }
 
+void Object::markCommitted()
+{
+  helium::BaseObject::markCommitted();
+  if (type() != ANARI_CAMERA)
+    deviceState()->objectUpdates.lastSceneCommit = helium::newTimeStamp();
+}
+
 bool Object::getProperty(
     const std::string_view &name, ANARIDataType type, void *ptr, uint32_t flags)
 {
@@ -23,6 +23,7 @@ struct Object : public helium::BaseObject
       uint32_t flags) override;
 
   virtual void commit() override;
+  void markCommitted() override;
 
   bool isValid() const override;
 
@@ -13,6 +13,7 @@ struct RenderingSemaphore
   RenderingSemaphore() = default;
 
   void arrayMapAcquire();
+  bool tryArrayMapAcquire(); // fails instead of waiting on a frame in flight
   void arrayMapRelease();
 
   void frameStart();
@@ -35,6 +36,15 @@ inline void RenderingSemaphore::arrayMapAcquire()
   m_arraysMapped++;
 }
 
+inline bool RenderingSemaphore::tryArrayMapAcquire()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_frameInFlight)
+    return false;
+  m_arraysMapped++;
+  return true;
+}
+
 inline void RenderingSemaphore::arrayMapRelease()
 {
   std::lock_guard<std::mutex> lock(m_mutex);
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Camera.h"
+#include "array/Array1D.h"
 // specific types
 #include "Orthographic.h"
 #include "Perspective.h"
@@ -27,9 +28,68 @@ void Camera::commit()
   m_up = normalize(getParam<float3>("up", float3(0.f, 1.f, 0.f)));
   m_imageRegion = float4(0.f, 0.f, 1.f, 1.f);
   getParam("imageRegion", ANARI_FLOAT32_BOX2, &m_imageRegion);
+  updateViews();
   markUpdated();
 }
 
+bool Camera::projectPoint(const float3 &, float2 &) const
+{
+  return false;
+}
+
+float2 Camera::pixelFootprint(float) const
+{
+  return float2(0.f);
+}
+
+void Camera::updateViews()
+{
+  m_views.clear();
+
+  const float3 right = normalize(cross(m_dir, m_up));
+  const float3 up = normalize(cross(right, m_dir));
+
+  std::vector<float2> offsets;
+  uint32_t columns = 1;
+
+  if (auto *viewOffsets = getParamObject<Array1D>("viewOffsets")) {
+    auto *begin = viewOffsets->beginAs<float2>();
+    auto *end = viewOffsets->endAs<float2>();
+    offsets.assign(begin, end);
+    columns = getParam<uint32_t>("viewColumns", uint32_t(offsets.size()));
+  } else {
+    const auto stereoMode = getParamString("stereoMode", "none");
+    const float halfIPD =
+        0.5f * getParam<float>("interpupillaryDistance", 0.0635f);
+    if (stereoMode == "left")
+      offsets = {float2(-halfIPD, 0.f)};
+    else if (stereoMode == "right")
+      offsets = {float2(halfIPD, 0.f)};
+    else if (stereoMode == "sideBySide") {
+      offsets = {float2(-halfIPD, 0.f), float2(halfIPD, 0.f)};
+      columns = 2;
+    } else if (stereoMode == "topBottom")
+      offsets = {float2(-halfIPD, 0.f), float2(halfIPD, 0.f)};
+  }
+
+  if (offsets.empty())
+    offsets.push_back(float2(0.f));
+
+  columns = std::clamp(columns, 1u, uint32_t(offsets.size()));
+  const uint32_t rows = (uint32_t(offsets.size()) + columns - 1) / columns;
+  const float2 viewSize(1.f / columns, 1.f / rows);
+
+  for (uint32_t i = 0; i < offsets.size(); i++) {
+    CameraView v;
+    v.eyeOffset = offsets[i].x * right + offsets[i].y * up;
+    // views are laid out left-to-right, top-to-bottom in the frame
+    const float2 cell(i % columns, rows - 1 - (i / columns));
+    v.region.lower = cell * viewSize;
+    v.region.upper = v.region.lower + viewSize;
+    m_views.push_back(v);
+  }
+}
+
 } // namespace helide
 
 HELIDE_ANARI_TYPEFOR_DEFINITION(helide::Camera *);
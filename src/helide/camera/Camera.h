@@ -7,6 +7,14 @@
 
 namespace helide {
 
+// One of the views rendered by a camera in a single frame; each view covers
+// the sub-rectangle 'region' (in normalized frame coordinates) of the frame
+struct CameraView
+{
+  float3 eyeOffset{0.f};
+  box2 region{float2(0.f), float2(1.f)};
+};
+
 struct Camera : public Object
 {
   Camera(HelideGlobalState *s);
@@ -18,23 +26,69 @@ struct Camera : public Object
       std::string_view type, HelideGlobalState *state);
 
   virtual Ray createRay(const float2 &screen) const = 0;
+  Ray createRay(const float2 &screen, uint32_t view) const;
+
+  // Inverse of createRay(): find the screen position whose ray passes through
+  // 'p', returns false if 'p' cannot be seen by this camera
+  virtual bool projectPoint(const float3 &p, float2 &screen) const;
+
+  // Footprint of a pixel 'pixelHeight' tall (in screen coordinates): its width
+  // at the ray origin (x) and its growth per unit distance along the ray (y)
+  virtual float2 pixelFootprint(float pixelHeight) const;
 
   float4 imageRegion() const;
+  const float3 &position() const;
+  const float3 &direction() const;
+
+  uint32_t numViews() const;
+  const CameraView &view(uint32_t i) const;
 
  protected:
   float3 m_pos;
   float3 m_dir;
   float3 m_up;
   float4 m_imageRegion;
+
+ private:
+  void updateViews();
+
+  std::vector<CameraView> m_views;
 };
 
 // Inlined definitions ////////////////////////////////////////////////////////
 
+inline Ray Camera::createRay(const float2 &screen, uint32_t view) const
+{
+  Ray ray = createRay(screen);
+  ray.org += m_views[view].eyeOffset;
+  return ray;
+}
+
 inline float4 Camera::imageRegion() const
 {
   return m_imageRegion;
 }
 
+inline const float3 &Camera::position() const
+{
+  return m_pos;
+}
+
+inline const float3 &Camera::direction() const
+{
+  return m_dir;
+}
+
+inline uint32_t Camera::numViews() const
+{
+  return uint32_t(m_views.size());
+}
+
+inline const CameraView &Camera::view(uint32_t i) const
+{
+  return m_views[i];
+}
+
 } // namespace helide
 
 HELIDE_ANARI_TYPEFOR_SPECIALIZATION(helide::Camera *, ANARI_CAMERA);
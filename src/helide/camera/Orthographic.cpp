@@ -29,4 +29,17 @@ Ray Orthographic::createRay(const float2 &screen) const
   return ray;
 }
 
+bool Orthographic::projectPoint(const float3 &p, float2 &screen) const
+{
+  const float3 d = p - m_pos_00;
+  screen.x = dot(d, m_pos_du) / dot(m_pos_du, m_pos_du);
+  screen.y = dot(d, m_pos_dv) / dot(m_pos_dv, m_pos_dv);
+  return dot(d, m_dir) > 0.f;
+}
+
+float2 Orthographic::pixelFootprint(float pixelHeight) const
+{
+  return float2(linalg::length(m_pos_dv) * pixelHeight, 0.f);
+}
+
 } // namespace helide
@@ -34,4 +34,25 @@ Ray Perspective::createRay(const float2 &screen) const
   return ray;
 }
 
+bool Perspective::projectPoint(const float3 &p, float2 &screen) const
+{
+  const float3 d = p - m_pos;
+  const float dist = dot(d, m_dir);
+  if (dist <= 0.f)
+    return false;
+
+  // m_dir_du/dv are orthogonal to m_dir, so intersect the image plane one unit
+  // in front of the camera and solve for the screen coordinates on it
+  const float3 onPlane = d / dist - m_dir_00;
+  screen.x = dot(onPlane, m_dir_du) / dot(m_dir_du, m_dir_du);
+  screen.y = dot(onPlane, m_dir_dv) / dot(m_dir_dv, m_dir_dv);
+  return true;
+}
+
+float2 Perspective::pixelFootprint(float pixelHeight) const
+{
+  // m_dir_dv spans the image plane one unit in front of the camera
+  return float2(0.f, linalg::length(m_dir_dv) * pixelHeight);
+}
+
 } // namespace helide
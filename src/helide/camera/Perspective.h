@@ -14,6 +14,8 @@ struct Perspective : public Camera
   void commit() override;
 
   Ray createRay(const float2 &screen) const override;
+  bool projectPoint(const float3 &p, float2 &screen) const override;
+  float2 pixelFootprint(float pixelHeight) const override;
 
  private:
    float3 m_dir_du;
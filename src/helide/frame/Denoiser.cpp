@@ -0,0 +1,166 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Denoiser.h"
+// std
+#include <cmath>
+#include <limits>
+// embree
+#include "algorithms/parallel_for.h"
+
+namespace helide {
+
+// Helper functions ///////////////////////////////////////////////////////////
+
+// Passes are parallelized over square tiles of pixels
+constexpr uint32_t DENOISE_TILE_SIZE = 16;
+
+// 5-tap B3 spline, the a-trous kernel is its outer product spread out by the
+// pass' step width
+constexpr float KERNEL[5] = {1.f / 16, 1.f / 4, 3.f / 8, 1.f / 4, 1.f / 16};
+
+constexpr float NORMAL_POWER = 64.f;
+constexpr float DEPTH_PHI = 0.01f; // relative to depth, per pixel of offset
+constexpr float ALBEDO_PHI = 0.05f;
+
+// Colors are filtered divided by albedo, pixels without one (background,
+// volumes) are filtered as is
+static float3 modulation(const float3 &albedo)
+{
+  return linalg::maxelem(albedo) > 0.f ? linalg::max(albedo, float3(1e-3f))
+                                       : float3(1.f);
+}
+
+// Rays which hit nothing keep their initial 'tfar'
+static bool missed(float depth)
+{
+  return !(depth < std::numeric_limits<float>::max());
+}
+
+template <typename PIXEL_T>
+static float edgeWeight(const PIXEL_T &p, const PIXEL_T &q, float offset)
+{
+  const bool pMissed = missed(p.depth);
+  const bool qMissed = missed(q.depth);
+  if (pMissed || qMissed)
+    return pMissed == qMissed ? 1.f : 0.f;
+
+  const bool pHasNormal = linalg::length2(p.normal) > 0.f;
+  const bool qHasNormal = linalg::length2(q.normal) > 0.f;
+  float wn = 1.f;
+  if (pHasNormal != qHasNormal)
+    return 0.f;
+  else if (pHasNormal) {
+    wn = std::pow(
+        std::max(linalg::dot(p.normal, q.normal), 0.f), NORMAL_POWER);
+  }
+
+  const float wz = std::exp(-std::abs(p.depth - q.depth)
+      / (DEPTH_PHI * std::max(p.depth, 1e-6f) * (1.f + offset)));
+
+  const float wa =
+      std::exp(-linalg::length2(p.albedo - q.albedo) / ALBEDO_PHI);
+
+  return wn * wz * wa;
+}
+
+// Denoiser definitions ///////////////////////////////////////////////////////
+
+void Denoiser::resize(const uint2 &size)
+{
+  m_size = size;
+  const size_t numPixels = size_t(size.x) * size.y;
+  m_pixels.resize(numPixels);
+  m_colors[0].resize(numPixels);
+  m_colors[1].resize(numPixels);
+  m_result = 0;
+}
+
+void Denoiser::setSample(uint32_t x, uint32_t y, const PixelSample &s)
+{
+  auto &p = m_pixels[size_t(y) * m_size.x + x];
+  p.color = s.color;
+  p.albedo = s.albedo;
+  p.normal = s.normal;
+  p.depth = s.depth;
+}
+
+void Denoiser::denoise(uint32_t iterations, float colorPhi)
+{
+  embree::parallel_for(m_size.y, [&](uint32_t y) {
+    for (uint32_t x = 0; x < m_size.x; x++) {
+      const size_t i = size_t(y) * m_size.x + x;
+      const auto &p = m_pixels[i];
+      const float3 rgb = float3(p.color.x, p.color.y, p.color.z);
+      m_colors[0][i] = float4(rgb / modulation(p.albedo), p.color.w);
+    }
+  });
+
+  uint32_t src = 0;
+  for (uint32_t i = 0; i < iterations; i++) {
+    filterPass(m_colors[src], m_colors[1 - src], 1 << i, colorPhi / (1 << i));
+    src = 1 - src;
+  }
+
+  m_result = src;
+}
+
+float4 Denoiser::color(uint32_t x, uint32_t y) const
+{
+  const size_t i = size_t(y) * m_size.x + x;
+  const auto &c = m_colors[m_result][i];
+  const float3 rgb = float3(c.x, c.y, c.z) * modulation(m_pixels[i].albedo);
+  return float4(rgb, c.w);
+}
+
+void Denoiser::filterPass(const std::vector<float4> &src,
+    std::vector<float4> &dst,
+    int stepWidth,
+    float colorPhi) const
+{
+  const uint2 numTiles =
+      (m_size + (DENOISE_TILE_SIZE - 1)) / DENOISE_TILE_SIZE;
+  const int w = m_size.x;
+  const int h = m_size.y;
+
+  embree::parallel_for(numTiles.x * numTiles.y, [&](uint32_t tile) {
+    const int x0 = (tile % numTiles.x) * DENOISE_TILE_SIZE;
+    const int y0 = (tile / numTiles.x) * DENOISE_TILE_SIZE;
+    const int x1 = std::min(x0 + int(DENOISE_TILE_SIZE), w);
+    const int y1 = std::min(y0 + int(DENOISE_TILE_SIZE), h);
+
+    for (int y = y0; y < y1; y++) {
+      for (int x = x0; x < x1; x++) {
+        const size_t pi = size_t(y) * w + x;
+        const auto &p = m_pixels[pi];
+        const float4 &cp = src[pi];
+
+        float4 sum(0.f);
+        float weightSum = 0.f;
+        for (int dy = -2; dy <= 2; dy++) {
+          const int qy = y + dy * stepWidth;
+          if (qy < 0 || qy >= h)
+            continue;
+          for (int dx = -2; dx <= 2; dx++) {
+            const int qx = x + dx * stepWidth;
+            if (qx < 0 || qx >= w)
+              continue;
+            const size_t qi = size_t(qy) * w + qx;
+            const float4 &cq = src[qi];
+            const float offset =
+                stepWidth * std::sqrt(float(dx * dx + dy * dy));
+            const float wc = std::exp(-linalg::length2(cp - cq) / colorPhi);
+            const float weight = KERNEL[dx + 2] * KERNEL[dy + 2] * wc
+                * edgeWeight(p, m_pixels[qi], offset);
+            sum += weight * cq;
+            weightSum += weight;
+          }
+        }
+
+        dst[pi] = weightSum > 0.f ? sum / weightSum : cp;
+      }
+    }
+  });
+}
+
+} // namespace helide
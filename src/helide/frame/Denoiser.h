@@ -0,0 +1,47 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "renderer/Renderer.h"
+// std
+#include <vector>
+
+namespace helide {
+
+// Edge-avoiding a-trous wavelet filter (Dammertz et al. 2010) guided by the
+// depth, normal and albedo of each pixel's primary hit. Colors are divided by
+// albedo before filtering so texture detail is not blurred away.
+struct Denoiser
+{
+  void resize(const uint2 &size);
+
+  void setSample(uint32_t x, uint32_t y, const PixelSample &s);
+
+  // Filter the stored colors in place, each iteration doubles the filter's
+  // footprint and halves how different two colors may be and still be mixed
+  void denoise(uint32_t iterations, float colorPhi);
+
+  float4 color(uint32_t x, uint32_t y) const;
+
+ private:
+  struct Pixel
+  {
+    float4 color{0.f};
+    float3 albedo{0.f};
+    float3 normal{0.f};
+    float depth{0.f};
+  };
+
+  void filterPass(const std::vector<float4> &src,
+      std::vector<float4> &dst,
+      int stepWidth,
+      float colorPhi) const;
+
+  uint2 m_size{0u};
+  std::vector<Pixel> m_pixels;
+  std::vector<float4> m_colors[2]; // ping-pong buffers of demodulated colors
+  uint32_t m_result{0};
+};
+
+} // namespace helide
@@ -36,6 +36,47 @@ static bool is_ready(const std::future<R> &f)
       || f.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
 }
 
+// Non-negative floats order the same way as their bit patterns, so packing
+// (depth, index) into one integer lets an atomic min keep the closest sample.
+static uint64_t packDepthAndIndex(float depth, uint32_t index)
+{
+  uint32_t bits = 0;
+  std::memcpy(&bits, &depth, sizeof(bits));
+  return (uint64_t(bits) << 32) | index;
+}
+
+static float unpackDepth(uint64_t v)
+{
+  const uint32_t bits = uint32_t(v >> 32);
+  float depth = 0.f;
+  std::memcpy(&depth, &bits, sizeof(depth));
+  return depth;
+}
+
+static void atomicMin(std::atomic<uint64_t> &a, uint64_t v)
+{
+  uint64_t prev = a.load(std::memory_order_relaxed);
+  while (v < prev && !a.compare_exchange_weak(prev, v)) {
+  }
+}
+
+constexpr uint64_t NO_REPROJECTED_SAMPLE = ~uint64_t(0);
+
+// Shading rates are chosen per tile; the tile size is the largest block size
+// so a block never straddles tiles of different rates.
+constexpr uint32_t SHADING_RATE_TILE_SIZE = 4;
+
+static bool sameSurface(const PixelSample &a, const PixelSample &b)
+{
+  return a.objId == b.objId && a.instId == b.instId
+      && std::abs(a.depth - b.depth) <= 0.05f * std::min(a.depth, b.depth);
+}
+
+// Deadline limited frames trace one ray per block of this size first, then
+// refine the image in tiles of full rate pixels.
+constexpr uint32_t COARSE_BLOCK_SIZE = 4;
+constexpr uint32_t REFINEMENT_TILE_SIZE = 16;
+
 // Frame definitions //////////////////////////////////////////////////////////
 
 Frame::Frame(HelideGlobalState *s) : helium::BaseFrame(s) {}
@@ -106,6 +147,66 @@ void Frame::commit()
     m_objIdBuffer.resize(numPixels);
   if (m_instIdType == ANARI_UINT32)
     m_instIdBuffer.resize(numPixels);
+
+  m_reprojection = getParam<bool>("reprojection", false);
+  const float refresh =
+      std::clamp(getParam<float>("reprojectionRefresh", 0.f), 0.f, 1.f);
+  m_refreshPeriod = refresh > 0.f ? uint32_t(std::round(1.f / refresh)) : 0;
+
+  m_history.clear();
+  m_nextHistory.clear();
+  m_reprojectedSamples = std::vector<std::atomic<uint64_t>>();
+  if (m_reprojection) {
+    m_history.resize(numPixels);
+    m_nextHistory.resize(numPixels);
+    m_reprojectedSamples = std::vector<std::atomic<uint64_t>>(numPixels);
+  }
+  m_historyCamera = nullptr;
+  m_historyLastRendered = 0;
+
+  m_fixationPoints = getParamObject<Array1D>("fixationPoints");
+  m_fovealRadius = getParam<float>("fovealRadius", 0.2f);
+  m_foveationFalloff = getParam<float>("foveationFalloff", 0.2f);
+  m_shadingRateImage = getParamObject<Array2D>("shadingRate");
+  if (m_fixationPoints
+      && m_fixationPoints->elementType() != ANARI_FLOAT32_VEC2) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "'fixationPoints' on ANARIFrame must be an array of FLOAT32_VEC2");
+    m_fixationPoints = nullptr;
+  }
+  if (m_shadingRateImage
+      && m_shadingRateImage->elementType() != ANARI_UINT8) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "'shadingRate' on ANARIFrame must be a 2D array of UINT8");
+    m_shadingRateImage = nullptr;
+  }
+
+  m_variableRate = m_fixationPoints || m_shadingRateImage;
+  m_numTiles = (m_frameData.size + (SHADING_RATE_TILE_SIZE - 1))
+      / SHADING_RATE_TILE_SIZE;
+  m_tileRates.assign(m_variableRate ? m_numTiles.x * m_numTiles.y : 0, 1);
+  m_samples.clear();
+  if (m_variableRate)
+    m_samples.resize(numPixels);
+
+  m_denoise = getParam<bool>("denoise", false);
+  m_denoiseIterations = std::clamp(getParam<uint32_t>("denoiseIterations", 4u),
+      1u,
+      8u);
+  m_denoiseColorPhi =
+      std::max(getParam<float>("denoiseColorPhi", 0.5f), 1e-6f);
+  m_denoiser.resize(m_denoise ? m_frameData.size : uint2(0u));
+
+  m_proxyPreview = getParam<bool>("proxyPreview", false);
+
+  m_timeBudget = std::max(getParam<float>("timeBudget", 0.f), 0.f);
+  if (m_timeBudget > 0.f && m_reprojection) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "'reprojection' on ANARIFrame is not used while 'timeBudget' is set");
+  }
+  m_pendingTiles.clear();
+  m_numRefinementTiles = 0;
+  m_completion = 1.f;
 }
 
 bool Frame::getProperty(
@@ -114,6 +215,15 @@ bool Frame::getProperty(
   if (type == ANARI_FLOAT32 && name == "duration") {
     helium::writeToVoidP(ptr, m_duration);
     return true;
+  } else if (type == ANARI_UINT64 && name == "reprojectedPixels") {
+    helium::writeToVoidP(ptr, m_numReprojectedPixels);
+    return true;
+  } else if (type == ANARI_FLOAT32 && name == "completion") {
+    helium::writeToVoidP(ptr, m_completion);
+    return true;
+  } else if (type == ANARI_BOOL && name == "provisional") {
+    helium::writeToVoidP(ptr, m_provisional);
+    return true;
   }
 
   return 0;
@@ -130,7 +240,19 @@ void Frame::renderFrame()
   m_future = async<void>(m_task, [&, state]() {
     auto start = std::chrono::steady_clock::now();
     state->renderingSemaphore.frameStart();
-    state->commitBufferFlush();
+    // With 'proxyPreview', pending BVH builds are not waited on and only
+    // view changes are flushed until they are done: proxies of the scene as
+    // last flushed are rendered instead
+    const bool preview = m_proxyPreview && state->bvhBuildsPending();
+    if (!preview) {
+      state->waitOnBVHBuilds();
+      // LOD prebuilds only hold back flushes which could change what they are
+      // being built from
+      if (state->commitBufferContains(blsSourceTypes()))
+        state->waitOnBVHPrebuilds();
+      state->commitBufferFlush();
+    } else
+      state->commitBufferFlush({ANARI_CAMERA, ANARI_FRAME, ANARI_RENDERER});
 
     if (!isValid()) {
       reportMessage(
@@ -140,27 +262,45 @@ void Frame::renderFrame()
       return;
     }
 
-    if (state->commitBufferLastFlush() <= m_frameLastRendered) {
+    // An unchanged frame is rendered again only to finish a provisional or
+    // deadline limited one
+    const bool changed =
+        state->commitBufferLastFlush() > m_frameLastRendered;
+    const bool resume = !preview && !m_provisional && !changed
+        && m_timeBudget > 0.f && !m_pendingTiles.empty();
+    if (!preview && !m_provisional && !changed && !resume) {
       state->renderingSemaphore.frameEnd();
       return;
     }
 
     m_frameLastRendered = helium::newTimeStamp();
 
-    m_world->embreeSceneUpdate();
+    // Array versions replaced while this frame renders stay alive until the
+    // epoch it started with is unpinned
+    const auto epoch = state->epochs.pin();
 
-    const auto &size = m_frameData.size;
-    embree::parallel_for(size.y, [&](int y) {
-      serial_for(size.x, [&](int x) {
-        auto screen = screenFromPixel(float2(x, y));
-        auto imageRegion = m_camera->imageRegion();
-        screen.x = linalg::lerp(imageRegion.x, imageRegion.z, screen.x);
-        screen.y = linalg::lerp(imageRegion.y, imageRegion.w, screen.y);
-        Ray ray = m_camera->createRay(screen);
-        writeSample(x, y, m_renderer->renderSample(screen, ray, *m_world));
-      });
-    });
+    if (m_proxyPreview && !preview) {
+      m_world->updateLevelsOfDetail(*m_camera);
+      if (m_world->embreeSceneNeedsUpdate())
+        startSceneUpdate();
+    }
 
+    if (m_proxyPreview && state->bvhBuildsPending()) {
+      renderProxies();
+      m_provisional = true;
+    } else {
+      m_provisional = false;
+      m_world->embreeSceneUpdate(m_camera.ptr);
+      if (m_timeBudget > 0.f) {
+        renderUntil(start
+                + std::chrono::microseconds(int64_t(m_timeBudget * 1000.f)),
+            resume);
+      } else
+        renderFullFrame();
+    }
+
+    m_frameData.frameID++;
+    state->epochs.unpin(epoch);
     state->renderingSemaphore.frameEnd();
 
     auto end = std::chrono::steady_clock::now();
@@ -168,6 +308,250 @@ void Frame::renderFrame()
   });
 }
 
+void Frame::renderFullFrame()
+{
+  // All camera views are traced in the same pass: each view-local pixel is
+  // rendered for every view back-to-back, so neighboring rays in a row hit
+  // the same parts of the scene across views.
+  const auto views = viewPixelRegions();
+  const auto imageRegion = m_camera->imageRegion();
+
+  uint2 viewSize(0u);
+  std::vector<float2> footprints;
+  for (const auto &v : views) {
+    viewSize = linalg::max(viewSize, v.size);
+    footprints.push_back(m_camera->pixelFootprint(
+        v.invSize.y * (imageRegion.w - imageRegion.y)));
+  }
+
+  // When only the camera moved, pixels covered by a valid sample from the
+  // previous frame are copied instead of traced.
+  const bool recordHistory = m_reprojection && views.size() == 1;
+  const bool reproject = canReprojectHistory(views.size());
+  if (reproject)
+    reprojectHistory(views[0], imageRegion);
+
+  if (m_variableRate)
+    updateShadingRates();
+
+  std::atomic<uint64_t> numReprojected{0};
+
+  embree::parallel_for(viewSize.y, [&](int y) {
+    uint64_t rowReprojected = 0;
+    serial_for(viewSize.x, [&](int x) {
+      for (uint32_t i = 0; i < views.size(); i++) {
+        const auto &v = views[i];
+        if (uint32_t(x) >= v.size.x || uint32_t(y) >= v.size.y)
+          continue;
+        const uint32_t px = v.origin.x + x;
+        const uint32_t py = v.origin.y + y;
+        if (m_variableRate && !isCoarseSample(px, py))
+          continue;
+        auto screen = float2(x, y) * v.invSize;
+        screen.x = linalg::lerp(imageRegion.x, imageRegion.z, screen.x);
+        screen.y = linalg::lerp(imageRegion.y, imageRegion.w, screen.y);
+        Ray ray = m_camera->createRay(screen, i);
+        ray.spreadWidth = footprints[i].x;
+        ray.spreadAngle = footprints[i].y;
+        if (reproject && reuseHistorySample(px, py, ray)) {
+          rowReprojected++;
+          continue;
+        }
+        const auto s =
+            m_renderer->renderSample(screen, ray, *m_world, m_denoise);
+        writeSample(px, py, s);
+        if (m_variableRate)
+          m_samples[py * m_frameData.size.x + px] = s;
+        if (recordHistory)
+          recordHistorySample(px, py, ray, s);
+      }
+    });
+    numReprojected += rowReprojected;
+  });
+
+  // Fill in the pixels of low-rate blocks from the traced block corners
+  if (m_variableRate) {
+    const auto size = m_frameData.size;
+    embree::parallel_for(size.y, [&](int y) {
+      for (uint32_t x = 0; x < size.x; x++) {
+        if (isCoarseSample(x, y))
+          continue;
+        writeSample(x, y, reconstructSample(x, y, size));
+        if (recordHistory)
+          m_nextHistory[y * size.x + x].sample.normal = float3(0.f);
+      }
+    });
+  }
+
+  // Colors are written only once filtered, see writeSample()
+  if (m_denoise)
+    writeDenoisedColors();
+
+  m_numReprojectedPixels = numReprojected;
+  if (recordHistory) {
+    std::swap(m_history, m_nextHistory);
+    m_historyCamera = m_camera;
+    m_historyLastRendered = helium::newTimeStamp();
+  } else
+    m_historyLastRendered = 0;
+}
+
+void Frame::renderUntil(
+    std::chrono::steady_clock::time_point deadline, bool resume)
+{
+  const auto views = viewPixelRegions();
+  if (!resume) {
+    if (m_variableRate)
+      updateShadingRates();
+    renderCoarsePass(views);
+    prioritizeTiles(views);
+  }
+
+  // Leave time to denoise whatever was refined by the deadline
+  if (m_denoise)
+    deadline -= m_denoiseDuration;
+
+  // Tiles are handed out most important first, each one only started before
+  // the deadline. With variable-rate shading each tile is reconstructed from
+  // its own traced samples.
+  std::atomic<uint32_t> nextTile{0};
+  std::vector<uint8_t> refined(m_pendingTiles.size(), 0);
+  embree::parallel_for(uint32_t(m_pendingTiles.size()), [&](uint32_t) {
+    const uint32_t t = nextTile++;
+    if (std::chrono::steady_clock::now() >= deadline)
+      return;
+    const auto &tile = m_pendingTiles[t];
+    const auto &v = views[tile.view];
+    const uint2 end =
+        linalg::min(tile.origin + REFINEMENT_TILE_SIZE, v.size);
+    const uint2 lower = v.origin + tile.origin;
+    const uint2 upper = v.origin + end;
+    for (uint32_t y = tile.origin.y; y < end.y; y++) {
+      for (uint32_t x = tile.origin.x; x < end.x; x++) {
+        const uint32_t px = v.origin.x + x;
+        const uint32_t py = v.origin.y + y;
+        if (m_variableRate && !isTracedSample(px, py, lower))
+          continue;
+        const auto s = renderViewSample(tile.view, v, x, y);
+        writeSample(px, py, s);
+        if (m_variableRate)
+          m_samples[py * m_frameData.size.x + px] = s;
+      }
+    }
+    if (m_variableRate) {
+      for (uint32_t py = lower.y; py < upper.y; py++) {
+        for (uint32_t px = lower.x; px < upper.x; px++) {
+          if (!isTracedSample(px, py, lower))
+            writeSample(px, py, reconstructSample(px, py, upper));
+        }
+      }
+    }
+    refined[t] = 1;
+  });
+
+  // Tiles passed over by the deadline are picked up by the next frame, if
+  // nothing changes until then
+  size_t numPending = 0;
+  for (size_t t = 0; t < m_pendingTiles.size(); t++) {
+    if (!refined[t])
+      m_pendingTiles[numPending++] = m_pendingTiles[t];
+  }
+  m_pendingTiles.resize(numPending);
+  m_completion = m_numRefinementTiles == 0
+      ? 1.f
+      : 1.f - float(numPending) / m_numRefinementTiles;
+
+  if (m_denoise)
+    writeDenoisedColors();
+
+  m_numReprojectedPixels = 0;
+  m_historyLastRendered = 0;
+}
+
+void Frame::renderCoarsePass(const std::vector<ViewPixels> &views)
+{
+  for (uint32_t i = 0; i < views.size(); i++) {
+    const auto &v = views[i];
+    const uint2 numBlocks =
+        (v.size + (COARSE_BLOCK_SIZE - 1)) / COARSE_BLOCK_SIZE;
+    embree::parallel_for(numBlocks.y, [&](uint32_t by) {
+      for (uint32_t bx = 0; bx < numBlocks.x; bx++) {
+        const uint2 lower = uint2(bx, by) * COARSE_BLOCK_SIZE;
+        const uint2 upper = linalg::min(lower + COARSE_BLOCK_SIZE, v.size);
+        const uint2 center = (lower + upper) / 2u;
+        const auto s = renderViewSample(i, v, center.x, center.y);
+        for (uint32_t y = lower.y; y < upper.y; y++) {
+          for (uint32_t x = lower.x; x < upper.x; x++)
+            writeSample(v.origin.x + x, v.origin.y + y, s);
+        }
+      }
+    });
+  }
+}
+
+void Frame::prioritizeTiles(const std::vector<ViewPixels> &views)
+{
+  const float2 frameSize(m_frameData.size);
+  const float invHeight = 1.f / frameSize.y;
+
+  const float2 *points = nullptr;
+  size_t numPoints = 0;
+  if (m_fixationPoints) {
+    points = m_fixationPoints->beginAs<float2>();
+    numPoints = m_fixationPoints->size();
+  }
+
+  // Tiles closest to a fixation point, or else to the center of their view,
+  // come first. Distances are in units of the frame height.
+  std::vector<std::pair<float, RefinementTile>> tiles;
+  for (uint32_t i = 0; i < views.size(); i++) {
+    const auto &v = views[i];
+    const float2 viewCenter = float2(v.origin) + 0.5f * float2(v.size);
+    for (uint32_t y = 0; y < v.size.y; y += REFINEMENT_TILE_SIZE) {
+      for (uint32_t x = 0; x < v.size.x; x += REFINEMENT_TILE_SIZE) {
+        const uint2 upper =
+            linalg::min(uint2(x, y) + REFINEMENT_TILE_SIZE, v.size);
+        const float2 center =
+            float2(v.origin) + 0.5f * float2(uint2(x, y) + upper);
+        float d = std::numeric_limits<float>::max();
+        for (size_t p = 0; p < numPoints; p++)
+          d = std::min(d, linalg::length(center - points[p] * frameSize));
+        if (numPoints == 0)
+          d = linalg::length(center - viewCenter);
+
+        RefinementTile tile;
+        tile.view = i;
+        tile.origin = uint2(x, y);
+        tiles.emplace_back(d * invHeight, tile);
+      }
+    }
+  }
+
+  std::stable_sort(tiles.begin(), tiles.end(), [](auto &a, auto &b) {
+    return a.first < b.first;
+  });
+
+  m_pendingTiles.clear();
+  for (const auto &t : tiles)
+    m_pendingTiles.push_back(t.second);
+  m_numRefinementTiles = uint32_t(m_pendingTiles.size());
+}
+
+PixelSample Frame::renderViewSample(
+    uint32_t i, const ViewPixels &v, uint32_t x, uint32_t y) const
+{
+  const auto imageRegion = m_camera->imageRegion();
+  auto screen = float2(x, y) * v.invSize;
+  screen.x = linalg::lerp(imageRegion.x, imageRegion.z, screen.x);
+  screen.y = linalg::lerp(imageRegion.y, imageRegion.w, screen.y);
+  Ray ray = m_camera->createRay(screen, i);
+  const float2 footprint = m_camera->pixelFootprint(
+      v.invSize.y * (imageRegion.w - imageRegion.y));
+  ray.spreadWidth = footprint.x;
+  ray.spreadAngle = footprint.y;
+  return m_renderer->renderSample(screen, ray, *m_world, m_denoise);
+}
+
 void *Frame::map(std::string_view channel,
     uint32_t *width,
     uint32_t *height,
@@ -236,41 +620,354 @@ void Frame::wait() const
   }
 }
 
-float2 Frame::screenFromPixel(const float2 &p) const
+std::vector<Frame::ViewPixels> Frame::viewPixelRegions() const
 {
-  return p * m_frameData.invSize;
+  std::vector<ViewPixels> retval(m_camera->numViews());
+  const float2 size(m_frameData.size);
+  for (uint32_t i = 0; i < retval.size(); i++) {
+    const auto &region = m_camera->view(i).region;
+    const auto lower = uint2(linalg::round(region.lower * size));
+    const auto upper = uint2(linalg::round(region.upper * size));
+    auto &v = retval[i];
+    v.origin = lower;
+    v.size = linalg::max(upper, lower) - lower;
+    v.invSize = 1.f / float2(linalg::max(v.size, uint2(1u)));
+  }
+  return retval;
+}
+
+bool Frame::canReprojectHistory(size_t numViews) const
+{
+  if (!m_reprojection || numViews != 1 || m_historyLastRendered == 0
+      || m_historyCamera != m_camera)
+    return false;
+
+  // Anything but the camera changing invalidates what was rendered
+  const auto &updates = deviceState()->objectUpdates;
+  return m_historyLastRendered > updates.lastSceneCommit
+      && m_historyLastRendered > updates.lastBLSReconstructSceneRequest
+      && m_historyLastRendered > updates.lastBLSCommitSceneRequest
+      && m_historyLastRendered > updates.lastTLSReconstructSceneRequest;
+}
+
+void Frame::reprojectHistory(const ViewPixels &v, const float4 &imageRegion)
+{
+  const auto size = m_frameData.size;
+  const float3 eye = m_camera->position() + m_camera->view(0).eyeOffset;
+  const float3 dir = m_camera->direction();
+  const float2 regionLower(imageRegion.x, imageRegion.y);
+  const float2 regionSize =
+      float2(imageRegion.z, imageRegion.w) - regionLower;
+
+  embree::parallel_for(size.y, [&](int y) {
+    for (uint32_t x = 0; x < size.x; x++)
+      m_reprojectedSamples[y * size.x + x] = NO_REPROJECTED_SAMPLE;
+  });
+
+  // Splat every reusable sample of the previous frame into the new frame,
+  // keeping the closest one when several land in the same pixel
+  embree::parallel_for(size.y, [&](int y) {
+    for (uint32_t x = 0; x < size.x; x++) {
+      const uint32_t idx = y * size.x + x;
+      const auto &h = m_history[idx];
+      if (h.sample.normal == float3(0.f))
+        continue;
+
+      float2 screen;
+      if (!m_camera->projectPoint(
+              h.position - m_camera->view(0).eyeOffset, screen))
+        continue;
+
+      screen = (screen - regionLower) / regionSize;
+      const float2 p = linalg::floor(screen * float2(v.size) + 0.5f);
+      if (p.x < 0.f || p.y < 0.f || p.x >= v.size.x || p.y >= v.size.y)
+        continue;
+
+      const float depth = linalg::dot(h.position - eye, dir);
+      if (depth <= 0.f)
+        continue;
+
+      const uint2 target = v.origin + uint2(p);
+      atomicMin(m_reprojectedSamples[target.y * size.x + target.x],
+          packDepthAndIndex(depth, idx));
+    }
+  });
+}
+
+bool Frame::reuseHistorySample(uint32_t x, uint32_t y, const Ray &ray)
+{
+  const auto size = m_frameData.size;
+  const uint64_t packed = m_reprojectedSamples[y * size.x + x];
+  if (packed == NO_REPROJECTED_SAMPLE)
+    return false;
+
+  // Spread a fraction of forced re-traces evenly across the frame over time
+  if (m_refreshPeriod != 0
+      && (x + 3 * y + uint32_t(m_frameData.frameID)) % m_refreshPeriod == 0)
+    return false;
+
+  // A much closer neighbor means this sample may be seen through a gap
+  // between foreground samples which spread apart (disocclusion)
+  const float depth = unpackDepth(packed);
+  for (int dy = -1; dy <= 1; dy++) {
+    for (int dx = -1; dx <= 1; dx++) {
+      const int nx = int(x) + dx;
+      const int ny = int(y) + dy;
+      if (nx < 0 || ny < 0 || nx >= int(size.x) || ny >= int(size.y))
+        continue;
+      const uint64_t n = m_reprojectedSamples[ny * size.x + nx];
+      if (n != NO_REPROJECTED_SAMPLE && unpackDepth(n) < 0.95f * depth)
+        return false;
+    }
+  }
+
+  // Reject surfaces now seen edge-on or from the other side
+  const auto &h = m_history[uint32_t(packed)];
+  const float cosNew = linalg::dot(h.sample.normal, -ray.dir);
+  const float cosOld = linalg::dot(h.sample.normal, -h.viewDir);
+  if (std::abs(cosNew) < 0.05f || (cosNew > 0.f) != (cosOld > 0.f))
+    return false;
+
+  // The history keeps the sample as first traced, so shading is redone from
+  // it for every new view instead of drifting
+  PixelSample s = h.sample;
+  s.depth = linalg::dot(h.position - ray.org, ray.dir);
+  m_renderer->reshadeSample(s, ray.dir);
+  writeSample(x, y, s);
+  if (m_variableRate)
+    m_samples[y * size.x + x] = s;
+  m_nextHistory[y * size.x + x] = h;
+  return true;
+}
+
+void Frame::recordHistorySample(
+    uint32_t x, uint32_t y, const Ray &ray, const PixelSample &s)
+{
+  auto &h = m_nextHistory[y * m_frameData.size.x + x];
+  h.sample = s;
+  if (s.normal != float3(0.f)) {
+    h.position = ray.org + ray.dir * s.depth;
+    h.viewDir = ray.dir;
+  }
+}
+
+void Frame::updateShadingRates()
+{
+  const float2 frameSize(m_frameData.size);
+  const float invHeight = 1.f / frameSize.y;
+
+  const float2 *points = nullptr;
+  size_t numPoints = 0;
+  if (m_fixationPoints) {
+    points = m_fixationPoints->beginAs<float2>();
+    numPoints = m_fixationPoints->size();
+  }
+
+  const uint8_t *rates = nullptr;
+  uint2 ratesSize(0u);
+  if (m_shadingRateImage) {
+    rates = m_shadingRateImage->dataAs<uint8_t>();
+    ratesSize = m_shadingRateImage->size();
+  }
+
+  for (uint32_t ty = 0; ty < m_numTiles.y; ty++) {
+    for (uint32_t tx = 0; tx < m_numTiles.x; tx++) {
+      const float2 center =
+          (float2(tx, ty) + 0.5f) * float(SHADING_RATE_TILE_SIZE);
+      uint32_t rate = 4;
+
+      if (rates) {
+        const auto r = uint2(center / frameSize * float2(ratesSize));
+        const uint8_t v =
+            rates[std::min(r.y, ratesSize.y - 1) * ratesSize.x
+                + std::min(r.x, ratesSize.x - 1)];
+        rate = std::min(rate, v <= 1 ? 1u : (v <= 2 ? 2u : 4u));
+      }
+
+      if (points) {
+        // Distances are measured in units of the frame height so the foveal
+        // region stays round on non-square frames
+        float d = std::numeric_limits<float>::max();
+        for (size_t i = 0; i < numPoints; i++) {
+          const float2 p = points[i] * frameSize;
+          d = std::min(d, linalg::length(center - p) * invHeight);
+        }
+        if (d <= m_fovealRadius)
+          rate = 1;
+        else if (d <= m_fovealRadius + m_foveationFalloff)
+          rate = std::min(rate, 2u);
+      }
+
+      m_tileRates[ty * m_numTiles.x + tx] = uint8_t(rate);
+    }
+  }
+}
+
+uint32_t Frame::shadingRate(uint32_t x, uint32_t y) const
+{
+  const uint32_t tx = x / SHADING_RATE_TILE_SIZE;
+  const uint32_t ty = y / SHADING_RATE_TILE_SIZE;
+  return m_tileRates[ty * m_numTiles.x + tx];
+}
+
+bool Frame::isCoarseSample(uint32_t x, uint32_t y) const
+{
+  const uint32_t rate = shadingRate(x, y);
+  return x % rate == 0 && y % rate == 0;
+}
+
+bool Frame::isTracedSample(uint32_t x, uint32_t y, const uint2 &lower) const
+{
+  // Pixels whose block starts before 'lower' are traced as well, so a region
+  // starting there can be reconstructed without samples from outside of it
+  const uint32_t rate = shadingRate(x, y);
+  return isCoarseSample(x, y) || x - x % rate < lower.x
+      || y - y % rate < lower.y;
+}
+
+PixelSample Frame::reconstructSample(
+    uint32_t x, uint32_t y, const uint2 &upper) const
+{
+  const auto size = m_frameData.size;
+  const uint32_t rate = shadingRate(x, y);
+
+  // Corners of the block containing (x, y), all of which were traced: block
+  // corners past the end of this block land on tile boundaries, which are
+  // traced at every rate. Corners at or past 'upper' are not used.
+  const uint32_t x0 = x - x % rate;
+  const uint32_t y0 = y - y % rate;
+  const uint32_t x1 = x0 + rate < upper.x ? x0 + rate : x0;
+  const uint32_t y1 = y0 + rate < upper.y ? y0 + rate : y0;
+  const float fx = float(x - x0) / rate;
+  const float fy = float(y - y0) / rate;
+
+  const PixelSample *corners[4] = {&m_samples[y0 * size.x + x0],
+      &m_samples[y0 * size.x + x1],
+      &m_samples[y1 * size.x + x0],
+      &m_samples[y1 * size.x + x1]};
+  const float bilinear[4] = {(1.f - fx) * (1.f - fy),
+      fx * (1.f - fy),
+      (1.f - fx) * fy,
+      fx * fy};
+
+  // Only blend corners showing the same surface as the closest corner, which
+  // keeps silhouettes and object boundaries sharp.
+  int nearest = 0;
+  for (int i = 1; i < 4; i++) {
+    if (bilinear[i] > bilinear[nearest])
+      nearest = i;
+  }
+
+  const PixelSample &ref = *corners[nearest];
+  PixelSample retval = ref; // depth and IDs come from the closest corner
+  retval.color = float4(0.f);
+  float totalWeight = 0.f;
+  for (int i = 0; i < 4; i++) {
+    if (bilinear[i] == 0.f || !sameSurface(*corners[i], ref))
+      continue;
+    retval.color += bilinear[i] * corners[i]->color;
+    totalWeight += bilinear[i];
+  }
+
+  retval.color /= totalWeight;
+  return retval;
+}
+
+void Frame::startSceneUpdate()
+{
+  auto *state = deviceState();
+  state->bvhBuildStarted();
+
+  // 'world' keeps the world alive until the update is done
+  auto world = m_world;
+  m_sceneUpdate = std::async(std::launch::async, [world, state]() mutable {
+    const auto epoch = state->epochs.pin();
+    auto start = std::chrono::steady_clock::now();
+    world->embreeSceneUpdate();
+    auto end = std::chrono::steady_clock::now();
+    state->epochs.unpin(epoch);
+    world = nullptr;
+    state->bvhBuildFinished(std::chrono::duration<float>(end - start).count());
+  });
+}
+
+void Frame::renderProxies()
+{
+  const auto boxes = m_world->proxyBoxes();
+  const auto views = viewPixelRegions();
+  const auto imageRegion = m_camera->imageRegion();
+
+  for (uint32_t i = 0; i < views.size(); i++) {
+    const auto &v = views[i];
+    embree::parallel_for(v.size.y, [&](uint32_t y) {
+      for (uint32_t x = 0; x < v.size.x; x++) {
+        auto screen = float2(x, y) * v.invSize;
+        screen.x = linalg::lerp(imageRegion.x, imageRegion.z, screen.x);
+        screen.y = linalg::lerp(imageRegion.y, imageRegion.w, screen.y);
+        const Ray ray = m_camera->createRay(screen, i);
+        writeSample(v.origin.x + x,
+            v.origin.y + y,
+            m_renderer->renderProxySample(screen, ray, boxes));
+      }
+    });
+  }
+
+  if (m_denoise)
+    writeDenoisedColors();
+
+  m_historyLastRendered = 0;
+}
+
+void Frame::writeDenoisedColors()
+{
+  const auto start = std::chrono::steady_clock::now();
+  m_denoiser.denoise(m_denoiseIterations, m_denoiseColorPhi);
+  const auto size = m_frameData.size;
+  embree::parallel_for(size.y, [&](uint32_t y) {
+    for (uint32_t x = 0; x < size.x; x++)
+      writeColor(size_t(y) * size.x + x, m_denoiser.color(x, y));
+  });
+  m_denoiseDuration = std::chrono::steady_clock::now() - start;
 }
 
 void Frame::writeSample(int x, int y, const PixelSample &s)
 {
   const auto idx = y * m_frameData.size.x + x;
+  if (m_denoise)
+    m_denoiser.setSample(x, y, s);
+  else
+    writeColor(idx, s.color);
+  if (!m_depthBuffer.empty())
+    m_depthBuffer[idx] = s.depth;
+  if (!m_primIdBuffer.empty())
+    m_primIdBuffer[idx] = s.primId;
+  if (!m_objIdBuffer.empty())
+    m_objIdBuffer[idx] = s.objId;
+  if (!m_instIdBuffer.empty())
+    m_instIdBuffer[idx] = s.instId;
+}
+
+void Frame::writeColor(size_t idx, const float4 &c)
+{
   auto *color = m_pixelBuffer.data() + (idx * m_perPixelBytes);
   switch (m_colorType) {
   case ANARI_UFIXED8_VEC4: {
-    auto c = helium::math::cvt_color_to_uint32(s.color);
-    std::memcpy(color, &c, sizeof(c));
+    auto v = helium::math::cvt_color_to_uint32(c);
+    std::memcpy(color, &v, sizeof(v));
     break;
   }
   case ANARI_UFIXED8_RGBA_SRGB: {
-    auto c = helium::math::cvt_color_to_uint32_srgb(s.color);
-    std::memcpy(color, &c, sizeof(c));
+    auto v = helium::math::cvt_color_to_uint32_srgb(c);
+    std::memcpy(color, &v, sizeof(v));
     break;
   }
   case ANARI_FLOAT32_VEC4: {
-    std::memcpy(color, &s.color, sizeof(s.color));
+    std::memcpy(color, &c, sizeof(c));
     break;
   }
   default:
     break;
   }
-  if (!m_depthBuffer.empty())
-    m_depthBuffer[idx] = s.depth;
-  if (!m_primIdBuffer.empty())
-    m_primIdBuffer[idx] = s.primId;
-  if (!m_objIdBuffer.empty())
-    m_objIdBuffer[idx] = s.objId;
-  if (!m_instIdBuffer.empty())
-    m_instIdBuffer[idx] = s.instId;
 }
 
 } // namespace helide
@@ -3,12 +3,17 @@
 
 #pragma once
 
+#include "Denoiser.h"
+#include "array/Array1D.h"
+#include "array/Array2D.h"
 #include "camera/Camera.h"
 #include "renderer/Renderer.h"
 #include "scene/World.h"
 // helium
 #include "helium/BaseFrame.h"
 // std
+#include <atomic>
+#include <chrono>
 #include <future>
 #include <vector>
 
@@ -44,8 +49,50 @@ struct Frame : public helium::BaseFrame
   void wait() const;
 
  private:
-  float2 screenFromPixel(const float2 &p) const;
+  struct ViewPixels
+  {
+    uint2 origin{0u};
+    uint2 size{0u};
+    float2 invSize{0.f};
+  };
+
+  std::vector<ViewPixels> viewPixelRegions() const;
+  void renderFullFrame();
+
+  // Deadline limited rendering //
+  //
+  // Variable-rate shading applies per refinement tile and the denoiser's last
+  // duration is taken off the deadline. Reprojection is not used.
+
+  void renderUntil(
+      std::chrono::steady_clock::time_point deadline, bool resume);
+  void renderCoarsePass(const std::vector<ViewPixels> &views);
+  void prioritizeTiles(const std::vector<ViewPixels> &views);
+  PixelSample renderViewSample(
+      uint32_t i, const ViewPixels &v, uint32_t x, uint32_t y) const;
+
+  void startSceneUpdate();
+  void renderProxies();
+  void writeDenoisedColors();
   void writeSample(int x, int y, const PixelSample &s);
+  void writeColor(size_t idx, const float4 &c);
+
+  // Temporal reprojection //
+
+  bool canReprojectHistory(size_t numViews) const;
+  void reprojectHistory(const ViewPixels &v, const float4 &imageRegion);
+  bool reuseHistorySample(uint32_t x, uint32_t y, const Ray &ray);
+  void recordHistorySample(
+      uint32_t x, uint32_t y, const Ray &ray, const PixelSample &s);
+
+  // Variable-rate shading //
+
+  void updateShadingRates();
+  uint32_t shadingRate(uint32_t x, uint32_t y) const;
+  bool isCoarseSample(uint32_t x, uint32_t y) const;
+  bool isTracedSample(uint32_t x, uint32_t y, const uint2 &lower) const;
+  PixelSample reconstructSample(
+      uint32_t x, uint32_t y, const uint2 &upper) const;
 
   //// Data ////
 
@@ -71,6 +118,54 @@ struct Frame : public helium::BaseFrame
   std::vector<uint32_t> m_objIdBuffer;
   std::vector<uint32_t> m_instIdBuffer;
 
+  struct HistorySample
+  {
+    float3 position{0.f};
+    float3 viewDir{0.f};
+    PixelSample sample; // zero sample.normal marks pixels which can't be reused
+  };
+
+  bool m_reprojection{false};
+  uint32_t m_refreshPeriod{0};
+  std::vector<HistorySample> m_history; // previous frame
+  std::vector<HistorySample> m_nextHistory; // frame being rendered
+  // per pixel: (depth bits << 32 | history index) of the closest sample
+  std::vector<std::atomic<uint64_t>> m_reprojectedSamples;
+  helium::IntrusivePtr<Camera> m_historyCamera;
+  helium::TimeStamp m_historyLastRendered{0};
+  uint64_t m_numReprojectedPixels{0};
+
+  helium::IntrusivePtr<Array1D> m_fixationPoints;
+  float m_fovealRadius{0.2f};
+  float m_foveationFalloff{0.2f};
+  helium::IntrusivePtr<Array2D> m_shadingRateImage;
+  bool m_variableRate{false};
+  // block size (1, 2 or 4 pixels square) traced with one ray, per 4x4 tile
+  std::vector<uint8_t> m_tileRates;
+  uint2 m_numTiles{0u};
+  std::vector<PixelSample> m_samples; // traced samples, for reconstruction
+
+  bool m_denoise{false};
+  uint32_t m_denoiseIterations{4};
+  float m_denoiseColorPhi{0.5f};
+  Denoiser m_denoiser;
+  std::chrono::steady_clock::duration m_denoiseDuration{0}; // last denoise
+
+  bool m_proxyPreview{false};
+  bool m_provisional{false}; // last frame showed proxies, see renderProxies()
+  std::future<void> m_sceneUpdate; // world BVH update started by this frame
+
+  struct RefinementTile
+  {
+    uint32_t view{0};
+    uint2 origin{0u}; // view-local pixel
+  };
+
+  float m_timeBudget{0.f}; // milliseconds, zero renders every frame in full
+  std::vector<RefinementTile> m_pendingTiles; // most important first
+  uint32_t m_numRefinementTiles{0};
+  float m_completion{1.f};
+
   helium::IntrusivePtr<Renderer> m_renderer;
   helium::IntrusivePtr<Camera> m_camera;
   helium::IntrusivePtr<World> m_world;
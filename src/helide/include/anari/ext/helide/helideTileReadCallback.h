@@ -0,0 +1,28 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Signature of the "tileCallback" parameter on helide 'image2D' samplers. The
+// device invokes it whenever a texture tile that is not resident in the tile
+// cache is touched while rendering. The callback must write the texels of the
+// region [x, x + width) x [y, y + height) into 'dst', where each row starts
+// 'rowPitchBytes' after the previous one. Return non-zero on success. This may
+// be called concurrently from multiple rendering threads.
+typedef int (*HelideTileReadCallback)(const void *userData,
+    uint32_t x,
+    uint32_t y,
+    uint32_t width,
+    uint32_t height,
+    uint64_t rowPitchBytes,
+    void *dst);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -84,6 +84,28 @@ static float4 backgroundColorFromImage(
   return linalg::lerp(v0, v1, interp_x.frac);
 }
 
+// Blend the volume in front of the surface and the background behind both
+static float4 compositeSample(const float3 &volumeColor,
+    float volumeOpacity,
+    const float3 &geometryColor,
+    float geometryOpacity,
+    const float4 &bgColorOpacity)
+{
+  const float3 bgColor(bgColorOpacity.x, bgColorOpacity.y, bgColorOpacity.z);
+
+  float3 color = linalg::min(volumeColor, float3(1.f));
+  float opacity = volumeOpacity;
+
+  accumulateValue(color,
+      linalg::min(geometryColor, float3(1.f)) * geometryOpacity,
+      opacity);
+  accumulateValue(opacity, geometryOpacity, opacity);
+  accumulateValue(color, bgColor, opacity);
+  accumulateValue(opacity, bgColorOpacity.w, opacity);
+
+  return {color, opacity};
+}
+
 // Renderer definitions ///////////////////////////////////////////////////////
 
 Renderer::Renderer(HelideGlobalState *s) : Object(ANARI_RENDERER, s)
@@ -108,18 +130,17 @@ void Renderer::commit()
   m_bgImage = getParamObject<Array2D>("background");
   m_ambientRadiance = getParam<float>("ambientRadiance", 1.f);
   m_mode = renderModeFromString(getParamString("mode", "default"));
+  m_shadeRay = shadeRayForMode(m_mode);
 }
 
 PixelSample Renderer::renderSample(
-    const float2 &screen, Ray ray, const World &w) const
+    const float2 &screen, Ray ray, const World &w, bool withAlbedo) const
 {
   PixelSample retval;
 
   // Intersect Surfaces //
 
-  RTCIntersectContext context;
-  rtcInitIntersectContext(&context);
-  rtcIntersect1(w.embreeScene(), &context, (RTCRayHit *)&ray);
+  w.intersectSurfaces(ray);
   const bool hitGeometry = ray.geomID != RTC_INVALID_GEOMETRY_ID;
 
   // Intersect Volumes //
@@ -128,12 +149,15 @@ PixelSample Renderer::renderSample(
   vray.org = ray.org;
   vray.dir = ray.dir;
   vray.t.upper = ray.tfar;
+  vray.spreadWidth = ray.spreadWidth;
+  vray.spreadAngle = ray.spreadAngle;
   w.intersectVolumes(vray);
   const bool hitVolume = vray.volume != nullptr;
 
   // Shade //
 
-  retval.color = shadeRay(screen, ray, vray, w);
+  retval.color =
+      (this->*m_shadeRay)(screen, ray, vray, w, retval.surfaceColor);
   retval.depth = hitVolume ? std::min(ray.tfar, vray.t.lower) : ray.tfar;
   if (hitGeometry || hitVolume) {
     retval.primId = hitVolume ? 0 : ray.primID;
@@ -142,6 +166,87 @@ PixelSample Renderer::renderSample(
                               : w.instanceFromRay(ray)->id();
   }
 
+  if (hitGeometry && !hitVolume) {
+    const auto *inst = w.instanceFromRay(ray);
+    retval.normal = linalg::normalize(linalg::mul(inst->xfmInvRot(), ray.Ng));
+    if (withAlbedo) {
+      const float4 c = w.surfaceFromRay(ray)->getSurfaceColor(ray);
+      retval.albedo = float3(c.x, c.y, c.z);
+    }
+  }
+
+  return retval;
+}
+
+void Renderer::reshadeSample(PixelSample &s, const float3 &dir) const
+{
+  if (s.normal == float3(0.f))
+    return;
+
+  // Reused samples are surface hits only, in front of which there's no volume
+  // and behind which the background doesn't show
+  if (m_mode == RenderMode::DEFAULT) {
+    const float3 c = shadeSurface(s.surfaceColor, s.normal, dir);
+    s.color = compositeSample(c, 0.f, c, 1.f, float4(0.f));
+  } else if (m_mode == RenderMode::OPACITY_HEATMAP) {
+    const float3 c = shadeSurface(s.surfaceColor, s.normal, dir);
+    s.color = compositeSample(float3(0.f), 0.f, c, 1.f, float4(0.f));
+  }
+}
+
+float3 Renderer::shadeSurface(
+    const float3 &c, const float3 &n, const float3 &dir) const
+{
+  const float falloff = std::abs(linalg::dot(-dir, n));
+  return linalg::min(
+      (0.8f * falloff * c + 0.2f * c) * m_ambientRadiance, float3(1.f));
+}
+
+PixelSample Renderer::renderProxySample(const float2 &screen,
+    const Ray &ray,
+    const std::vector<ProxyBox> &boxes) const
+{
+  PixelSample retval;
+  retval.depth = ray.tfar;
+
+  const ProxyBox *hit = nullptr;
+  float3 hitNormal(0.f);
+  const float3 invDir = 1.f / ray.dir;
+  for (const auto &b : boxes) {
+    const float3 t0 = (b.bounds.lower - ray.org) * invDir;
+    const float3 t1 = (b.bounds.upper - ray.org) * invDir;
+    const float3 tEnter = linalg::min(t0, t1);
+    const float tNear = linalg::maxelem(tEnter);
+    const float tFar = linalg::minelem(linalg::max(t0, t1));
+    // Boxes containing the ray origin are shown from the inside
+    const float t = tNear >= ray.tnear ? tNear : tFar;
+    if (tFar < tNear || t < ray.tnear || t >= retval.depth)
+      continue;
+    hit = &b;
+    retval.depth = t;
+    const int axis = tNear >= ray.tnear
+        ? (tEnter.x == tNear ? 0 : (tEnter.y == tNear ? 1 : 2))
+        : 0;
+    hitNormal = float3(0.f);
+    hitNormal[axis] = ray.dir[axis] < 0.f ? 1.f : -1.f;
+  }
+
+  if (!hit) {
+    retval.color =
+        m_bgImage ? backgroundColorFromImage(*m_bgImage, screen) : m_bgColor;
+    return retval;
+  }
+
+  const float falloff = std::abs(linalg::dot(-ray.dir, hitNormal));
+  const float3 c(0.8f);
+  retval.color = float4(
+      linalg::min((0.8f * falloff * c + 0.2f * c) * m_ambientRadiance,
+          float3(1.f)),
+      1.f);
+  retval.normal = hitNormal;
+  retval.primId = 0;
+  retval.objId = hit->objId;
+  retval.instId = hit->instId;
   return retval;
 }
 
@@ -151,10 +256,51 @@ Renderer *Renderer::createInstance(
   return new Renderer(s);
 }
 
+Renderer::ShadeRayFcn Renderer::shadeRayForMode(RenderMode mode)
+{
+  switch (mode) {
+  case RenderMode::PRIM_ID:
+    return &Renderer::shadeRay<RenderMode::PRIM_ID>;
+  case RenderMode::GEOM_ID:
+    return &Renderer::shadeRay<RenderMode::GEOM_ID>;
+  case RenderMode::INST_ID:
+    return &Renderer::shadeRay<RenderMode::INST_ID>;
+  case RenderMode::RAY_UVW:
+    return &Renderer::shadeRay<RenderMode::RAY_UVW>;
+  case RenderMode::HIT_SURFACE:
+    return &Renderer::shadeRay<RenderMode::HIT_SURFACE>;
+  case RenderMode::HIT_VOLUME:
+    return &Renderer::shadeRay<RenderMode::HIT_VOLUME>;
+  case RenderMode::BACKFACE:
+    return &Renderer::shadeRay<RenderMode::BACKFACE>;
+  case RenderMode::NG:
+    return &Renderer::shadeRay<RenderMode::NG>;
+  case RenderMode::NG_ABS:
+    return &Renderer::shadeRay<RenderMode::NG_ABS>;
+  case RenderMode::GEOMETRY_ATTRIBUTE_0:
+    return &Renderer::shadeRay<RenderMode::GEOMETRY_ATTRIBUTE_0>;
+  case RenderMode::GEOMETRY_ATTRIBUTE_1:
+    return &Renderer::shadeRay<RenderMode::GEOMETRY_ATTRIBUTE_1>;
+  case RenderMode::GEOMETRY_ATTRIBUTE_2:
+    return &Renderer::shadeRay<RenderMode::GEOMETRY_ATTRIBUTE_2>;
+  case RenderMode::GEOMETRY_ATTRIBUTE_3:
+    return &Renderer::shadeRay<RenderMode::GEOMETRY_ATTRIBUTE_3>;
+  case RenderMode::GEOMETRY_ATTRIBUTE_COLOR:
+    return &Renderer::shadeRay<RenderMode::GEOMETRY_ATTRIBUTE_COLOR>;
+  case RenderMode::OPACITY_HEATMAP:
+    return &Renderer::shadeRay<RenderMode::OPACITY_HEATMAP>;
+  case RenderMode::DEFAULT:
+  default:
+    return &Renderer::shadeRay<RenderMode::DEFAULT>;
+  }
+}
+
+template <RenderMode MODE>
 float4 Renderer::shadeRay(const float2 &screen,
     const Ray &ray,
     const VolumeRay &vray,
-    const World &w) const
+    const World &w,
+    float3 &surfaceColor) const
 {
   const bool hitGeometry = ray.geomID != RTC_INVALID_GEOMETRY_ID;
   const bool hitVolume = vray.volume != nullptr;
@@ -168,7 +314,6 @@ float4 Renderer::shadeRay(const float2 &screen,
   const float3 bgColor(bgColorOpacity.x, bgColorOpacity.y, bgColorOpacity.z);
 
   float3 color(0.f, 0.f, 0.f);
-  float opacity = 0.f;
 
   float3 volumeColor = color;
   float volumeOpacity = 0.f;
@@ -176,7 +321,8 @@ float4 Renderer::shadeRay(const float2 &screen,
   float3 geometryColor(0.f, 0.f, 0.f);
   float geometryOpacity = hitGeometry ? 1.f : 0.f;
 
-  switch (m_mode) {
+  // MODE is a compile-time constant, so only one case survives per kernel
+  switch (MODE) {
   case RenderMode::PRIM_ID:
     color = hitGeometry ? makeRandomColor(ray.primID) : bgColor;
     break;
@@ -232,15 +378,12 @@ float4 Renderer::shadeRay(const float2 &screen,
       const Surface *surface = w.surfaceFromRay(ray);
 
       const auto n = linalg::mul(inst->xfmInvRot(), ray.Ng);
-      const auto falloff =
-          std::abs(linalg::dot(-ray.dir, linalg::normalize(n)));
       const float4 sc = surface->getSurfaceColor(ray);
       const float so = surface->getSurfaceOpacity(ray);
       const float o = surface->adjustedAlpha(std::clamp(sc.w * so, 0.f, 1.f));
-      const float3 c = m_heatmap->valueAtLinear<float3>(o);
-      const float3 fc = c * falloff;
+      surfaceColor = m_heatmap->valueAtLinear<float3>(o);
       geometryColor =
-          linalg::min((0.8f * fc + 0.2f * c) * m_ambientRadiance, float3(1.f));
+          shadeSurface(surfaceColor, linalg::normalize(n), ray.dir);
     }
   } break;
   case RenderMode::DEFAULT:
@@ -250,13 +393,10 @@ float4 Renderer::shadeRay(const float2 &screen,
       const Surface *surface = w.surfaceFromRay(ray);
 
       const auto n = linalg::mul(inst->xfmInvRot(), ray.Ng);
-      const auto falloff =
-          std::abs(linalg::dot(-ray.dir, linalg::normalize(n)));
       const float4 c = surface->getSurfaceColor(ray);
-      const float3 sc = float3(c.x, c.y, c.z) * falloff;
-      volumeColor = geometryColor = linalg::min(
-          (0.8f * sc + 0.2f * float3(c.x, c.y, c.z)) * m_ambientRadiance,
-          float3(1.f));
+      surfaceColor = float3(c.x, c.y, c.z);
+      volumeColor = geometryColor =
+          shadeSurface(surfaceColor, linalg::normalize(n), ray.dir);
     }
 
     if (hitVolume)
@@ -265,17 +405,11 @@ float4 Renderer::shadeRay(const float2 &screen,
   } break;
   }
 
-  geometryColor = linalg::min(geometryColor, float3(1.f));
-
-  color = linalg::min(volumeColor, float3(1.f));
-  opacity = volumeOpacity;
-
-  accumulateValue(color, geometryColor * geometryOpacity, opacity);
-  accumulateValue(opacity, geometryOpacity, opacity);
-  accumulateValue(color, bgColor, opacity);
-  accumulateValue(opacity, bgColorOpacity.w, opacity);
-
-  return {color, opacity};
+  return compositeSample(volumeColor,
+      volumeOpacity,
+      geometryColor,
+      geometryOpacity,
+      bgColorOpacity);
 }
 
 } // namespace helide
@@ -14,6 +14,9 @@ struct PixelSample
 {
   float4 color;
   float depth;
+  float3 normal{0.f}; // world space, only set for surface (not volume) hits
+  float3 albedo{0.f}; // surface base color, only set if asked for (denoising)
+  float3 surfaceColor{0.f}; // unlit, set if shading depends on the view
   uint32_t primId{~0u};
   uint32_t objId{~0u};
   uint32_t instId{~0u};
@@ -49,17 +52,46 @@ struct Renderer : public Object
 
   virtual void commit() override;
 
-  PixelSample renderSample(const float2 &screen, Ray ray, const World &w) const;
+  PixelSample renderSample(const float2 &screen,
+      Ray ray,
+      const World &w,
+      bool withAlbedo = false) const;
+
+  // Redo the view dependent shading of a surface sample (if any) for a ray
+  // along 'dir', e.g. when reusing it from another view
+  void reshadeSample(PixelSample &s, const float3 &dir) const;
+
+  // Shade the closest of 'boxes' along 'ray' instead of the full scene
+  PixelSample renderProxySample(const float2 &screen,
+      const Ray &ray,
+      const std::vector<ProxyBox> &boxes) const;
 
   static Renderer *createInstance(
       std::string_view subtype, HelideGlobalState *d);
 
  private:
+  using ShadeRayFcn = float4 (Renderer::*)(const float2 &screen,
+      const Ray &ray,
+      const VolumeRay &vray,
+      const World &w,
+      float3 &surfaceColor) const;
+
+  // Shading kernel specialized on the render mode, selected on commit
+  template <RenderMode MODE>
   float4 shadeRay(const float2 &screen,
       const Ray &ray,
       const VolumeRay &vray,
-      const World &w) const;
+      const World &w,
+      float3 &surfaceColor) const;
+
+  // Lit color of a surface with unlit color 'c' and normal 'n' seen along
+  // 'dir', as shaded by the default and opacity heatmap modes
+  float3 shadeSurface(
+      const float3 &c, const float3 &n, const float3 &dir) const;
+
+  static ShadeRayFcn shadeRayForMode(RenderMode mode);
 
+  ShadeRayFcn m_shadeRay{&Renderer::shadeRay<RenderMode::DEFAULT>};
   float4 m_bgColor{float3(0.f), 1.f};
   float m_ambientRadiance{1.f};
   RenderMode m_mode{RenderMode::DEFAULT};
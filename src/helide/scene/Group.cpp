@@ -3,16 +3,19 @@
 
 #include "Group.h"
 // std
+#include <chrono>
 #include <iterator>
 
 namespace helide {
 
 Group::Group(HelideGlobalState *s) : Object(ANARI_GROUP, s)
 {
+  s->registerGroup(this);
 }
 
 Group::~Group()
 {
+  deviceState()->unregisterGroup(this);
   cleanup();
 }
 
@@ -20,15 +23,7 @@ bool Group::getProperty(
     const std::string_view &name, ANARIDataType type, void *ptr, uint32_t flags)
 {
   if (name == "bounds" && type == ANARI_FLOAT32_BOX3) {
-    if (flags & ANARI_WAIT) {
-      embreeSceneConstruct();
-      embreeSceneCommit();
-    }
-    auto bounds = getEmbreeSceneBounds(m_embreeScene);
-    for (auto *v : volumes()) {
-      if (v->isValid())
-        bounds.extend(v->bounds());
-    }
+    const auto bounds = this->bounds();
     std::memcpy(ptr, &bounds, sizeof(bounds));
     return true;
   }
@@ -54,11 +49,54 @@ void Group::commit()
   }
 }
 
+box3 Group::bounds() const
+{
+  box3 b;
+
+  if (m_surfaceData) {
+    std::for_each(m_surfaceData->handlesBegin(),
+        m_surfaceData->handlesEnd(),
+        [&](auto *o) {
+          auto *s = (Surface *)o;
+          if (s && s->isValid())
+            b.extend(s->geometry()->bounds());
+        });
+  }
+
+  for (auto *v : volumes()) {
+    if (v->isValid())
+      b.extend(v->bounds());
+  }
+
+  return b;
+}
+
+std::vector<const Surface *> Group::committedSurfaces() const
+{
+  std::vector<const Surface *> retval;
+  if (m_surfaceData) {
+    std::for_each(m_surfaceData->handlesBegin(),
+        m_surfaceData->handlesEnd(),
+        [&](auto *o) {
+          auto *s = (const Surface *)o;
+          if (s && s->isValid())
+            retval.push_back(s);
+        });
+  }
+  return retval;
+}
+
 const std::vector<Surface *> &Group::surfaces() const
 {
   return m_surfaces;
 }
 
+void Group::updateSurfaces()
+{
+  waitOnEmbreeSceneBuild();
+  collectSurfaces();
+}
+
 const std::vector<Volume *> &Group::volumes() const
 {
   return m_volumes;
@@ -96,6 +134,8 @@ void Group::markCommitted()
   Object::markCommitted();
   deviceState()->objectUpdates.lastBLSReconstructSceneRequest =
       helium::newTimeStamp();
+  if (deviceState()->bvhBuilds.eager)
+    embreeSceneConstructAsync();
 }
 
 RTCScene Group::embreeScene() const
@@ -104,10 +144,42 @@ RTCScene Group::embreeScene() const
 }
 
 void Group::embreeSceneConstruct()
+{
+  waitOnEmbreeSceneBuild();
+  constructEmbreeScene();
+}
+
+void Group::embreeSceneCommit()
+{
+  waitOnEmbreeSceneBuild();
+  commitEmbreeScene();
+}
+
+bool Group::embreeSceneUpToDate() const
+{
+  if (embreeSceneBuildPending())
+    return false;
+
+  const auto &state = *deviceState();
+  return m_embreeScene
+      && m_objectUpdates.lastSceneConstruction
+      > state.objectUpdates.lastBLSReconstructAllRequest
+      && m_objectUpdates.lastSceneCommit
+      > state.objectUpdates.lastBLSCommitSceneRequest;
+}
+
+bool Group::embreeSceneBuildPending() const
+{
+  return m_embreeSceneBuild.valid()
+      && m_embreeSceneBuild.wait_for(std::chrono::seconds(0))
+      != std::future_status::ready;
+}
+
+void Group::constructEmbreeScene()
 {
   const auto &state = *deviceState();
   if (m_objectUpdates.lastSceneConstruction
-      > state.objectUpdates.lastBLSReconstructSceneRequest)
+      > state.objectUpdates.lastBLSReconstructAllRequest)
     return;
 
   reportMessage(ANARI_SEVERITY_DEBUG, "helide::Group rebuilding embree scene");
@@ -115,40 +187,47 @@ void Group::embreeSceneConstruct()
   rtcReleaseScene(m_embreeScene);
   m_embreeScene = rtcNewScene(deviceState()->embreeDevice);
 
-  if (m_surfaceData) {
-    uint32_t id = 0;
-    std::for_each(m_surfaceData->handlesBegin(),
-        m_surfaceData->handlesEnd(),
-        [&](auto *o) {
-          auto *s = (Surface *)o;
-          if (s && s->isValid()) {
-            m_surfaces.push_back(s);
-            rtcAttachGeometryByID(
-                m_embreeScene, s->geometry()->embreeGeometry(), id++);
-          } else {
-            reportMessage(ANARI_SEVERITY_DEBUG,
-                "helide::Group rejecting invalid surface(%p) in building BLS",
-                s);
-            auto *g = s->geometry();
-            if (!g || !g->isValid()) {
-              reportMessage(
-                  ANARI_SEVERITY_DEBUG, "    helide::Geometry is invalid");
-            }
-            auto *m = s->material();
-            if (!m || !m->isValid()) {
-              reportMessage(
-                  ANARI_SEVERITY_DEBUG, "    helide::Material is invalid");
-            }
-          }
-        });
-  }
+  collectSurfaces();
+  uint32_t id = 0;
+  for (auto *s : m_surfaces)
+    rtcAttachGeometryByID(m_embreeScene, s->geometry()->embreeGeometry(), id++);
 
   m_objectUpdates.lastSceneConstruction = helium::newTimeStamp();
   m_objectUpdates.lastSceneCommit = 0;
-  embreeSceneCommit();
+  commitEmbreeScene();
 }
 
-void Group::embreeSceneCommit()
+void Group::collectSurfaces()
+{
+  m_surfaces.clear();
+  if (!m_surfaceData)
+    return;
+
+  std::for_each(m_surfaceData->handlesBegin(),
+      m_surfaceData->handlesEnd(),
+      [&](auto *o) {
+        auto *s = (Surface *)o;
+        if (s && s->isValid()) {
+          m_surfaces.push_back(s);
+        } else {
+          reportMessage(ANARI_SEVERITY_DEBUG,
+              "helide::Group rejecting invalid surface(%p) in building BLS",
+              s);
+          auto *g = s->geometry();
+          if (!g || !g->isValid()) {
+            reportMessage(
+                ANARI_SEVERITY_DEBUG, "    helide::Geometry is invalid");
+          }
+          auto *m = s->material();
+          if (!m || !m->isValid()) {
+            reportMessage(
+                ANARI_SEVERITY_DEBUG, "    helide::Material is invalid");
+          }
+        }
+      });
+}
+
+void Group::commitEmbreeScene()
 {
   const auto &state = *deviceState();
   if (!m_embreeScene
@@ -162,8 +241,64 @@ void Group::embreeSceneCommit()
   m_objectUpdates.lastSceneCommit = helium::newTimeStamp();
 }
 
+void Group::embreeSceneConstructAsync()
+{
+  startEmbreeSceneBuild(false);
+}
+
+void Group::embreeScenePrebuildAsync()
+{
+  startEmbreeSceneBuild(true);
+}
+
+void Group::embreeSceneRelease()
+{
+  if (!m_embreeScene || embreeSceneBuildPending())
+    return;
+
+  reportMessage(ANARI_SEVERITY_DEBUG, "helide::Group releasing embree scene");
+
+  rtcReleaseScene(m_embreeScene);
+  m_embreeScene = nullptr;
+  m_objectUpdates.lastSceneConstruction = 0;
+  m_objectUpdates.lastSceneCommit = 0;
+  // Another instance may still bind this group, which then gets rebuilt
+  deviceState()->objectUpdates.lastBLSReconstructSceneRequest =
+      helium::newTimeStamp();
+}
+
+void Group::startEmbreeSceneBuild(bool prebuild)
+{
+  waitOnEmbreeSceneBuild();
+
+  auto *state = deviceState();
+  state->bvhBuildStarted(prebuild);
+
+  // cleanup() waits for the build, so the group outlives it
+
+  m_embreeSceneBuild =
+      std::async(std::launch::async, [this, state, prebuild]() {
+        const auto epoch = state->epochs.pin();
+        auto start = std::chrono::steady_clock::now();
+        constructEmbreeScene();
+        commitEmbreeScene();
+        auto end = std::chrono::steady_clock::now();
+        state->epochs.unpin(epoch);
+        state->bvhBuildFinished(
+            std::chrono::duration<float>(end - start).count(), prebuild);
+      });
+}
+
+void Group::waitOnEmbreeSceneBuild() const
+{
+  if (m_embreeSceneBuild.valid())
+    m_embreeSceneBuild.wait();
+}
+
 void Group::cleanup()
 {
+  waitOnEmbreeSceneBuild();
+
   if (m_surfaceData)
     m_surfaceData->removeCommitObserver(this);
   if (m_volumeData)
@@ -179,14 +314,6 @@ void Group::cleanup()
   m_embreeScene = nullptr;
 }
 
-box3 getEmbreeSceneBounds(RTCScene scene)
-{
-  RTCBounds eb;
-  rtcGetSceneBounds(scene, &eb);
-  return box3({eb.lower_x, eb.lower_y, eb.lower_z},
-      {eb.upper_x, eb.upper_y, eb.upper_z});
-}
-
 } // namespace helide
 
 HELIDE_ANARI_TYPEFOR_DEFINITION(helide::Group *);
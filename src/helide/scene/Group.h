@@ -7,6 +7,8 @@
 #include "light/Light.h"
 #include "surface/Surface.h"
 #include "volume/Volume.h"
+// std
+#include <future>
 
 namespace helide {
 
@@ -22,7 +24,18 @@ struct Group : public Object
 
   void commit() override;
 
+  // Union of the cached bounds of valid surfaces and volumes, does not
+  // require the BLS to be built
+  box3 bounds() const;
+
+  // Valid surfaces from the 'surface' parameter, unlike surfaces() this does
+  // not depend on the BLS having been built
+  std::vector<const Surface *> committedSurfaces() const;
+
   const std::vector<Surface *> &surfaces() const;
+  // Gather surfaces() without building the BLS, for groups whose surfaces
+  // are attached to the world's TLS directly
+  void updateSurfaces();
   const std::vector<Volume *> &volumes() const;
 
   void intersectVolumes(VolumeRay &ray) const;
@@ -30,10 +43,27 @@ struct Group : public Object
   void markCommitted() override;
 
   RTCScene embreeScene() const;
+  // Both wait for a background build of this group's BLS to finish first
   void embreeSceneConstruct();
   void embreeSceneCommit();
 
+  // Build (and commit) the BLS on a background thread, tracked as one of the
+  // device's pending BVH builds
+  void embreeSceneConstructAsync();
+  // Same, but for a group not bound yet (an LOD level), so frames do not wait
+  // on it
+  void embreeScenePrebuildAsync();
+  // Drop the BLS of a group which is no longer bound, unless it is building
+  void embreeSceneRelease();
+  bool embreeSceneUpToDate() const;
+  bool embreeSceneBuildPending() const;
+
  private:
+  void collectSurfaces();
+  void constructEmbreeScene();
+  void commitEmbreeScene();
+  void startEmbreeSceneBuild(bool prebuild);
+  void waitOnEmbreeSceneBuild() const;
   void cleanup();
 
   // Geometry //
@@ -55,10 +85,9 @@ struct Group : public Object
   } m_objectUpdates;
 
   RTCScene m_embreeScene{nullptr};
+  std::future<void> m_embreeSceneBuild;
 };
 
-box3 getEmbreeSceneBounds(RTCScene scene);
-
 } // namespace helide
 
 HELIDE_ANARI_TYPEFOR_SPECIALIZATION(helide::Group *, ANARI_GROUP);
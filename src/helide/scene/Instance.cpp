@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Instance.h"
+// subtypes
+#include "LODInstance.h"
 
 namespace helide {
 
@@ -16,11 +18,18 @@ Instance::~Instance()
   rtcReleaseGeometry(m_embreeGeometry);
 }
 
+Instance *Instance::createInstance(
+    std::string_view subtype, HelideGlobalState *s)
+{
+  if (subtype == "lod")
+    return new LODInstance(s);
+  else
+    return new Instance(s);
+}
+
 void Instance::commit()
 {
-  m_id = getParam<uint32_t>("id", ~0u);
-  m_xfm = getParam<mat4>("transform", mat4(linalg::identity));
-  m_xfmInvRot = linalg::inverse(extractRotation(m_xfm));
+  commitTransform();
   m_group = getParamObject<Group>("group");
   if (!m_group)
     reportMessage(ANARI_SEVERITY_WARNING, "missing 'group' on ANARIInstance");
@@ -56,6 +65,12 @@ Group *Instance::group()
   return m_group.ptr;
 }
 
+box3 Instance::bounds() const
+{
+  const box3 b = group()->bounds();
+  return xfmIsIdentity() ? b : xfmBox(xfm(), b);
+}
+
 RTCGeometry Instance::embreeGeometry() const
 {
   return m_embreeGeometry;
@@ -69,6 +84,11 @@ void Instance::embreeGeometryUpdate()
   rtcCommitGeometry(m_embreeGeometry);
 }
 
+bool Instance::updateLevelOfDetail(const float3 &)
+{
+  return false;
+}
+
 void Instance::markCommitted()
 {
   Object::markCommitted();
@@ -81,6 +101,13 @@ bool Instance::isValid() const
   return m_group;
 }
 
+void Instance::commitTransform()
+{
+  m_id = getParam<uint32_t>("id", ~0u);
+  m_xfm = getParam<mat4>("transform", mat4(linalg::identity));
+  m_xfmInvRot = linalg::inverse(extractRotation(m_xfm));
+}
+
 } // namespace helide
 
 HELIDE_ANARI_TYPEFOR_DEFINITION(helide::Instance *);
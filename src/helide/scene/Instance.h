@@ -12,6 +12,9 @@ struct Instance : public Object
   Instance(HelideGlobalState *s);
   ~Instance() override;
 
+  static Instance *createInstance(
+      std::string_view subtype, HelideGlobalState *s);
+
   void commit() override;
 
   uint32_t id() const;
@@ -23,18 +26,29 @@ struct Instance : public Object
   const Group *group() const;
   Group *group();
 
+  // Bounds of the bound group in world space
+  box3 bounds() const;
+
   RTCGeometry embreeGeometry() const;
   void embreeGeometryUpdate();
 
+  // Select which group to bind for a camera at 'eye', returns true if the
+  // bound group changed (only instances with multiple levels of detail)
+  virtual bool updateLevelOfDetail(const float3 &eye);
+
   void markCommitted() override;
 
   bool isValid() const override;
 
+ protected:
+  void commitTransform();
+
+  helium::IntrusivePtr<Group> m_group;
+
  private:
   uint32_t m_id{~0u};
   mat4 m_xfm;
   mat3 m_xfmInvRot;
-  helium::IntrusivePtr<Group> m_group;
   RTCGeometry m_embreeGeometry{nullptr};
 };
 
@@ -0,0 +1,205 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "LODInstance.h"
+
+namespace helide {
+
+LODInstance::LODInstance(HelideGlobalState *s) : Instance(s) {}
+
+LODInstance::~LODInstance()
+{
+  cleanup();
+}
+
+bool LODInstance::getProperty(
+    const std::string_view &name, ANARIDataType type, void *ptr, uint32_t flags)
+{
+  if (name == "level" && type == ANARI_UINT32) {
+    helium::writeToVoidP(ptr, m_currentLevel);
+    return true;
+  }
+
+  return Instance::getProperty(name, type, ptr, flags);
+}
+
+void LODInstance::commit()
+{
+  cleanup();
+  commitTransform();
+
+  m_levelData = getParamObject<ObjectArray>("group");
+  if (!m_levelData) {
+    reportMessage(
+        ANARI_SEVERITY_WARNING, "missing 'group' array on 'lod' ANARIInstance");
+    return;
+  }
+
+  std::for_each(m_levelData->handlesBegin(),
+      m_levelData->handlesEnd(),
+      [&](auto *o) {
+        if (o && o->isValid())
+          m_levels.push_back((Group *)o);
+      });
+
+  if (m_levels.empty()) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "no valid groups in 'group' array on 'lod' ANARIInstance");
+    return;
+  }
+
+  m_levelData->addCommitObserver(this);
+
+  auto *distances = getParamObject<Array1D>("switchDistance");
+  auto *sizes = getParamObject<Array1D>("switchSize");
+  if (distances) {
+    m_thresholds.assign(distances->beginAs<float>(), distances->endAs<float>());
+  } else if (sizes) {
+    m_useProjectedSize = true;
+    // Level metric is the inverse of the projected size, so smaller
+    // projected size thresholds map to larger (ascending) thresholds.
+    std::transform(sizes->beginAs<float>(),
+        sizes->endAs<float>(),
+        std::back_inserter(m_thresholds),
+        [](float s) {
+          return s > 0.f ? 1.f / s : std::numeric_limits<float>::max();
+        });
+  }
+
+  if (m_thresholds.size() + 1 < m_levels.size()) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "'lod' ANARIInstance has %zu levels but only %zu switch thresholds,"
+        " extra levels will never be used",
+        m_levels.size(),
+        m_thresholds.size());
+    m_levels.resize(m_thresholds.size() + 1);
+  }
+
+  m_hysteresis = std::clamp(getParam<float>("hysteresis", 0.1f), 0.f, 1.f);
+
+  // Start at the coarsest level so the first frame never pays for building
+  // the full resolution BLS unless the camera is actually close enough.
+  m_currentLevel = uint32_t(m_levels.size() - 1);
+  m_group = m_levels[m_currentLevel];
+}
+
+bool LODInstance::updateLevelOfDetail(const float3 &eye)
+{
+  if (m_levels.size() < 2)
+    return false;
+
+  const float metric = levelMetric(eye);
+  if (metric < 0.f)
+    return false;
+
+  uint32_t level = m_currentLevel;
+  while (level + 1 < m_levels.size()
+      && metric > m_thresholds[level] * (1.f + m_hysteresis))
+    level++;
+  while (level > 0 && metric < m_thresholds[level - 1] * (1.f - m_hysteresis))
+    level--;
+
+  bool switched = false;
+  if (level != m_currentLevel) {
+    // Keep the current level until the new one's BLS is ready
+    if (m_levels[level]->embreeSceneUpToDate()) {
+      reportMessage(ANARI_SEVERITY_DEBUG,
+          "helide::LODInstance switching from level %u to %u",
+          m_currentLevel,
+          level);
+      selectLevel(level);
+      switched = true;
+    } else
+      prebuildLevel(level);
+  }
+
+  releaseDistantLevels(level);
+  prebuildAdjacentLevels(metric);
+  return switched;
+}
+
+float LODInstance::levelMetric(const float3 &eye)
+{
+  // Bounds come from whichever level is currently bound, which is close
+  // enough to the bounds of every other level to drive selection.
+  const box3 bounds = m_group->bounds();
+  if (isEmpty(bounds))
+    return -1.f; // nothing to measure
+
+  const float3 c = 0.5f * (bounds.lower + bounds.upper);
+  const float4 center = linalg::mul(xfm(), float4(c.x, c.y, c.z, 1.f));
+  const float distance =
+      linalg::length(float3(center.x, center.y, center.z) - eye);
+
+  if (!m_useProjectedSize)
+    return distance;
+
+  // Projected size is approximated by the angular diameter of the bounding
+  // sphere, which is independent of the camera's field of view.
+  const float3 scale(linalg::length(xfm()[0]),
+      linalg::length(xfm()[1]),
+      linalg::length(xfm()[2]));
+  const float diameter = linalg::length(size(bounds)) * linalg::maxelem(scale);
+  return diameter > 0.f ? distance / diameter
+                        : std::numeric_limits<float>::max();
+}
+
+void LODInstance::selectLevel(uint32_t level)
+{
+  m_currentLevel = level;
+  m_group = m_levels[level];
+  deviceState()->objectUpdates.lastTLSReconstructSceneRequest =
+      helium::newTimeStamp();
+}
+
+void LODInstance::prebuildLevel(uint32_t level)
+{
+  auto *g = m_levels[level];
+  if (!g->embreeSceneUpToDate() && !g->embreeSceneBuildPending())
+    g->embreeScenePrebuildAsync();
+}
+
+void LODInstance::prebuildAdjacentLevels(float metric)
+{
+  // Start building a neighboring level once the metric is within this
+  // (relative) margin of the threshold which switches to it
+  constexpr float PREBUILD_MARGIN = 0.1f;
+
+  const uint32_t level = m_currentLevel;
+  if (level + 1 < m_levels.size()) {
+    const float coarser = m_thresholds[level] * (1.f + m_hysteresis);
+    if (metric > coarser * (1.f - PREBUILD_MARGIN))
+      prebuildLevel(level + 1);
+  }
+  if (level > 0) {
+    const float finer = m_thresholds[level - 1] * (1.f - m_hysteresis);
+    if (metric < finer * (1.f + PREBUILD_MARGIN))
+      prebuildLevel(level - 1);
+  }
+}
+
+void LODInstance::releaseDistantLevels(uint32_t target)
+{
+  // Levels more than one step away from the bound one (other than the one
+  // being switched to) are not needed again soon, so free their BLS
+  for (uint32_t i = 0; i < m_levels.size(); i++) {
+    const uint32_t d =
+        i > m_currentLevel ? i - m_currentLevel : m_currentLevel - i;
+    auto *g = m_levels[i];
+    if (d > 1 && g != m_levels[target] && g != m_group.ptr)
+      g->embreeSceneRelease();
+  }
+}
+
+void LODInstance::cleanup()
+{
+  if (m_levelData)
+    m_levelData->removeCommitObserver(this);
+  m_levelData = nullptr;
+  m_levels.clear();
+  m_thresholds.clear();
+  m_useProjectedSize = false;
+  m_group = nullptr;
+}
+
+} // namespace helide
@@ -0,0 +1,51 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Instance.h"
+#include "array/Array1D.h"
+
+namespace helide {
+
+// Instance which binds one of several groups (ordered finest to coarsest)
+// depending on how far the instance is from the camera. Levels are switched
+// with hysteresis so small camera motions around a threshold do not cause
+// the TLS to be rebuilt every frame. Only the levels next to the bound one
+// keep a BLS: each is prebuilt in the background as the camera nears the
+// threshold switching to it.
+struct LODInstance : public Instance
+{
+  LODInstance(HelideGlobalState *s);
+  ~LODInstance() override;
+
+  bool getProperty(const std::string_view &name,
+      ANARIDataType type,
+      void *ptr,
+      uint32_t flags) override;
+
+  void commit() override;
+
+  bool updateLevelOfDetail(const float3 &eye) override;
+
+ private:
+  float levelMetric(const float3 &eye);
+  void selectLevel(uint32_t level);
+  void prebuildLevel(uint32_t level);
+  void prebuildAdjacentLevels(float metric);
+  void releaseDistantLevels(uint32_t target);
+  void cleanup();
+
+  helium::IntrusivePtr<ObjectArray> m_levelData;
+  std::vector<Group *> m_levels;
+
+  // Thresholds on the distance to the camera (or the inverse of the projected
+  // size) at which level i switches to level i + 1, in ascending order
+  std::vector<float> m_thresholds;
+  bool m_useProjectedSize{false};
+  float m_hysteresis{0.1f};
+
+  uint32_t m_currentLevel{0};
+};
+
+} // namespace helide
@@ -25,15 +25,7 @@ bool World::getProperty(
     const std::string_view &name, ANARIDataType type, void *ptr, uint32_t flags)
 {
   if (name == "bounds" && type == ANARI_FLOAT32_BOX3) {
-    if (flags & ANARI_WAIT)
-      embreeSceneUpdate();
-    auto bounds = getEmbreeSceneBounds(m_embreeScene);
-    for (auto *i : instances()) {
-      for (auto *v : i->group()->volumes()) {
-        if (v->isValid())
-          bounds.extend(v->bounds());
-      }
-    }
+    const auto bounds = this->bounds();
     std::memcpy(ptr, &bounds, sizeof(bounds));
     return true;
   }
@@ -105,6 +97,46 @@ const std::vector<Instance *> &World::instances() const
   return m_instances;
 }
 
+box3 World::bounds() const
+{
+  box3 b;
+  for (auto *i : instances())
+    b.extend(i->bounds());
+  return b;
+}
+
+std::vector<ProxyBox> World::proxyBoxes() const
+{
+  std::vector<ProxyBox> boxes;
+  for (auto *i : instances()) {
+    for (auto *s : i->group()->committedSurfaces()) {
+      ProxyBox p;
+      const box3 b = s->geometry()->bounds();
+      p.bounds = i->xfmIsIdentity() ? b : xfmBox(i->xfm(), b);
+      p.objId = s->id();
+      p.instId = i->id();
+      if (!isEmpty(p.bounds))
+        boxes.push_back(p);
+    }
+  }
+  return boxes;
+}
+
+void World::intersectSurfaces(Ray &ray) const
+{
+  RTCIntersectContext context;
+  rtcInitIntersectContext(&context);
+  rtcIntersect1(m_embreeScene, &context, (RTCRayHit *)&ray);
+
+  if (ray.geomID == RTC_INVALID_GEOMETRY_ID
+      || ray.instID != RTC_INVALID_GEOMETRY_ID)
+    return;
+
+  const auto &f = m_flattenedSurfaces[ray.geomID - m_instances.size()];
+  ray.instID = f.instID;
+  ray.geomID = f.geomID;
+}
+
 void World::intersectVolumes(VolumeRay &ray) const
 {
   const auto &insts = instances();
@@ -121,13 +153,43 @@ RTCScene World::embreeScene() const
   return m_embreeScene;
 }
 
-void World::embreeSceneUpdate()
+void World::embreeSceneUpdate(const Camera *camera)
 {
+  if (camera)
+    updateLevelsOfDetail(*camera);
+  if (embreeSceneNeedsUpdate())
+    selectFlattenedInstances();
   rebuildBLSs();
   recommitBLSs();
   rebuildTLS();
 }
 
+bool World::embreeSceneNeedsUpdate() const
+{
+  const auto &state = *deviceState();
+  return state.objectUpdates.lastBLSReconstructSceneRequest
+      >= m_objectUpdates.lastBLSReconstructCheck
+      || state.objectUpdates.lastBLSCommitSceneRequest
+      >= m_objectUpdates.lastBLSCommitCheck
+      || state.objectUpdates.lastTLSReconstructSceneRequest
+      >= m_objectUpdates.lastTLSBuild;
+}
+
+void World::updateLevelsOfDetail(const Camera &camera)
+{
+  size_t numChanged = 0;
+  std::for_each(m_instances.begin(), m_instances.end(), [&](auto *inst) {
+    if (inst->updateLevelOfDetail(camera.position()))
+      numChanged++;
+  });
+
+  if (numChanged > 0) {
+    reportMessage(ANARI_SEVERITY_DEBUG,
+        "helide::World switched level of detail on %zu instances",
+        numChanged);
+  }
+}
+
 void World::rebuildBLSs()
 {
   const auto &state = *deviceState();
@@ -137,11 +199,11 @@ void World::rebuildBLSs()
   }
 
   m_objectUpdates.lastTLSBuild = 0; // BLS changed, so need to build TLS
-  reportMessage(ANARI_SEVERITY_DEBUG,
-      "helide::World rebuilding %zu BLSs",
-      m_instances.size());
-  std::for_each(m_instances.begin(), m_instances.end(), [&](auto *inst) {
-    inst->group()->embreeSceneConstruct();
+  const auto groups = groupsWithBLS();
+  reportMessage(
+      ANARI_SEVERITY_DEBUG, "helide::World rebuilding %zu BLSs", groups.size());
+  std::for_each(groups.begin(), groups.end(), [&](auto *g) {
+    g->embreeSceneConstruct();
   });
 
   m_objectUpdates.lastBLSReconstructCheck = helium::newTimeStamp();
@@ -157,11 +219,12 @@ void World::recommitBLSs()
   }
 
   m_objectUpdates.lastTLSBuild = 0; // BLS changed, so need to build TLS
+  const auto groups = groupsWithBLS();
   reportMessage(ANARI_SEVERITY_DEBUG,
       "helide::World recommitting %zu BLSs",
-      m_instances.size());
-  std::for_each(m_instances.begin(), m_instances.end(), [&](auto *inst) {
-    inst->group()->embreeSceneCommit();
+      groups.size());
+  std::for_each(groups.begin(), groups.end(), [&](auto *g) {
+    g->embreeSceneCommit();
   });
 
   m_objectUpdates.lastBLSCommitCheck = helium::newTimeStamp();
@@ -182,13 +245,32 @@ void World::rebuildTLS()
   rtcReleaseScene(m_embreeScene);
   m_embreeScene = rtcNewScene(deviceState()->embreeDevice);
 
+  m_flattenedSurfaces.clear();
+
+  size_t numFlattened = 0;
+
   uint32_t id = 0;
   std::for_each(m_instances.begin(), m_instances.end(), [&](auto *i) {
-    if (i && i->isValid() && !i->group()->surfaces().empty()) {
-      i->embreeGeometryUpdate();
-      rtcAttachGeometryByID(m_embreeScene, i->embreeGeometry(), id);
+    if (i && i->isValid() && !i->group()->committedSurfaces().empty()) {
+      if (isFlattened(id)) {
+        const auto &surfaces = i->group()->surfaces();
+        for (uint32_t s = 0; s < surfaces.size(); s++) {
+          auto g = surfaces[s]->geometry()->embreeGeometry();
+          const uint32_t geomID =
+              uint32_t(m_instances.size() + m_flattenedSurfaces.size());
+          rtcAttachGeometryByID(m_embreeScene, g, geomID);
+          m_flattenedSurfaces.push_back({id, s});
+        }
+        numFlattened++;
+      } else {
+        // No-ops unless the instance was flattened when BLSs were last built
+        i->group()->embreeSceneConstruct();
+        i->group()->embreeSceneCommit();
+        i->embreeGeometryUpdate();
+        rtcAttachGeometryByID(m_embreeScene, i->embreeGeometry(), id);
+      }
     } else {
-      if (i->group()->surfaces().empty()) {
+      if (i->group()->committedSurfaces().empty()) {
         reportMessage(ANARI_SEVERITY_DEBUG,
             "helide::World rejecting empty surfaces in instance(%p) "
             "when building TLS",
@@ -203,10 +285,77 @@ void World::rebuildTLS()
     id++;
   });
 
+  if (numFlattened > 0) {
+    reportMessage(ANARI_SEVERITY_DEBUG,
+        "helide::World flattened %zu instances (%zu surfaces) into the TLS",
+        numFlattened,
+        m_flattenedSurfaces.size());
+  }
+
   rtcCommitScene(m_embreeScene);
   m_objectUpdates.lastTLSBuild = helium::newTimeStamp();
 }
 
+void World::selectFlattenedInstances()
+{
+  std::vector<Group *> groups;
+  for (auto *i : m_instances) {
+    if (i && i->isValid())
+      groups.push_back(i->group());
+  }
+
+  std::vector<RTCGeometry> attached;
+  m_flattened.assign(m_instances.size(), 0);
+  for (size_t id = 0; id < m_instances.size(); id++) {
+    auto *i = m_instances[id];
+    if (!i || !i->isValid() || i->group()->committedSurfaces().empty()
+        || !canFlatten(*i, groups, attached))
+      continue;
+
+    // The group's BLS is not built, so its surfaces are gathered here
+    i->group()->updateSurfaces();
+    for (auto *s : i->group()->surfaces())
+      attached.push_back(s->geometry()->embreeGeometry());
+    m_flattened[id] = 1;
+  }
+}
+
+bool World::isFlattened(size_t id) const
+{
+  return id < m_flattened.size() && m_flattened[id];
+}
+
+std::vector<Group *> World::groupsWithBLS() const
+{
+  std::vector<Group *> groups;
+  for (size_t id = 0; id < m_instances.size(); id++) {
+    if (!isFlattened(id))
+      groups.push_back(m_instances[id]->group());
+  }
+  return groups;
+}
+
+bool World::canFlatten(const Instance &inst,
+    const std::vector<Group *> &groups,
+    const std::vector<RTCGeometry> &attached) const
+{
+  if (!inst.xfmIsIdentity())
+    return false;
+
+  // A group used by several instances is cheaper to build once and instance
+  if (std::count(groups.begin(), groups.end(), inst.group()) != 1)
+    return false;
+
+  // Embree can't attach the same geometry to one scene twice
+  for (auto *s : inst.group()->committedSurfaces()) {
+    auto g = s->geometry()->embreeGeometry();
+    if (std::find(attached.begin(), attached.end(), g) != attached.end())
+      return false;
+  }
+
+  return true;
+}
+
 void World::cleanup()
 {
   if (m_instanceData)
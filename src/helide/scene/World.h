@@ -4,9 +4,19 @@
 #pragma once
 
 #include "Instance.h"
+#include "camera/Camera.h"
 
 namespace helide {
 
+// World space bounds of one surface, rendered in its place while BVHs are
+// still being built (see the 'proxyPreview' frame parameter)
+struct ProxyBox
+{
+  box3 bounds;
+  uint32_t objId{~0u};
+  uint32_t instId{~0u};
+};
+
 struct World : public Object
 {
   World(HelideGlobalState *s);
@@ -21,6 +31,12 @@ struct World : public Object
 
   const std::vector<Instance *> &instances() const;
 
+  box3 bounds() const;
+  std::vector<ProxyBox> proxyBoxes() const;
+
+  // Trace against the TLS and report hits on flattened instances with the
+  // same instance/geometry IDs they would have if they were instanced
+  void intersectSurfaces(Ray &ray) const;
   void intersectVolumes(VolumeRay &ray) const;
 
   const Instance *instanceFromRay(const Ray &ray) const;
@@ -28,12 +44,21 @@ struct World : public Object
   const Surface *surfaceFromRay(const Ray &ray) const;
 
   RTCScene embreeScene() const;
-  void embreeSceneUpdate();
+  void embreeSceneUpdate(const Camera *camera = nullptr);
+  bool embreeSceneNeedsUpdate() const;
+
+  void updateLevelsOfDetail(const Camera &camera);
 
  private:
+  void selectFlattenedInstances();
+  bool isFlattened(size_t id) const;
+  std::vector<Group *> groupsWithBLS() const;
   void rebuildBLSs();
   void recommitBLSs();
   void rebuildTLS();
+  bool canFlatten(const Instance &inst,
+      const std::vector<Group *> &groups,
+      const std::vector<RTCGeometry> &attached) const;
   void cleanup();
 
   helium::IntrusivePtr<ObjectArray> m_zeroSurfaceData;
@@ -58,6 +83,17 @@ struct World : public Object
   } m_objectUpdates;
 
   RTCScene m_embreeScene{nullptr};
+
+  // Surfaces of single use, untransformed instances are attached to the TLS
+  // directly, using IDs past the end of 'm_instances'
+  struct FlattenedSurface
+  {
+    uint32_t instID{RTC_INVALID_GEOMETRY_ID};
+    uint32_t geomID{RTC_INVALID_GEOMETRY_ID};
+  };
+  std::vector<FlattenedSurface> m_flattenedSurfaces;
+  // Per instance, set when its group is flattened and so has no BLS built
+  std::vector<uint8_t> m_flattened;
 };
 
 // Inlined definitions ////////////////////////////////////////////////////////
@@ -24,61 +24,12 @@ void Surface::commit()
   }
 }
 
-const Geometry *Surface::geometry() const
-{
-  return m_geometry.ptr;
-}
-
-const Material *Surface::material() const
-{
-  return m_material.ptr;
-}
-
-float4 Surface::getSurfaceColor(const Ray &ray) const
-{
-  auto &state = *deviceState();
-  auto &imc = state.invalidMaterialColor;
-
-  auto *mat = material();
-
-  if (!mat)
-    return float4(imc.x, imc.y, imc.z, 1.f);
-
-  const auto colorAttribute = mat->colorAttribute();
-  const auto *colorSampler = mat->colorSampler();
-  if (colorSampler && colorSampler->isValid())
-    return colorSampler->getSample(*geometry(), ray);
-  else if (colorAttribute == Attribute::NONE)
-    return material()->color();
-  else
-    return geometry()->getAttributeValue(colorAttribute, ray);
-}
-
-float Surface::getSurfaceOpacity(const Ray &ray) const
-{
-  auto &state = *deviceState();
-  auto &imc = state.invalidMaterialColor;
-
-  auto *mat = material();
-
-  if (!mat)
-    return 0.f;
-
-  const auto opacityAttribute = mat->opacityAttribute();
-  const auto *opacitySampler = mat->opacitySampler();
-  if (opacitySampler && opacitySampler->isValid())
-    return opacitySampler->getSample(*geometry(), ray).x;
-  else if (opacityAttribute == Attribute::NONE)
-    return material()->opacity();
-  else
-    return geometry()->getAttributeValue(opacityAttribute, ray).x;
-}
-
 void Surface::markCommitted()
 {
   Object::markCommitted();
-  deviceState()->objectUpdates.lastBLSReconstructSceneRequest =
-      helium::newTimeStamp();
+  auto &updates = deviceState()->objectUpdates;
+  updates.lastBLSReconstructSceneRequest = helium::newTimeStamp();
+  updates.lastBLSReconstructAllRequest = updates.lastBLSReconstructSceneRequest;
 }
 
 bool Surface::isValid() const
@@ -40,6 +40,34 @@ inline uint32_t Surface::id() const
   return m_id;
 }
 
+inline const Geometry *Surface::geometry() const
+{
+  return m_geometry.ptr;
+}
+
+inline const Material *Surface::material() const
+{
+  return m_material.ptr;
+}
+
+inline float4 Surface::getSurfaceColor(const Ray &ray) const
+{
+  auto *mat = material();
+
+  if (!mat) {
+    auto &imc = deviceState()->invalidMaterialColor;
+    return float4(imc.x, imc.y, imc.z, 1.f);
+  }
+
+  return mat->getSurfaceColor(*geometry(), ray);
+}
+
+inline float Surface::getSurfaceOpacity(const Ray &ray) const
+{
+  auto *mat = material();
+  return mat ? mat->getSurfaceOpacity(*geometry(), ray) : 0.f;
+}
+
 inline float Surface::adjustedAlpha(float a) const
 {
   if (!material())
@@ -71,6 +71,8 @@ void Cone::commit()
         return float4(v, radius ? radius[rID++] : m_globalRadius);
       });
     }
+
+    computeBounds(vr, numCones * 2);
   }
 
   {
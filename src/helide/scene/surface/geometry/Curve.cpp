@@ -59,6 +59,8 @@ void Curve::commit()
     std::transform(begin, end, vr, [&](const float3 &v) {
       return float4(v, radius ? radius[rID++] : m_globalRadius);
     });
+
+    computeBounds(vr, m_vertexPosition->size());
   }
 
   if (m_index) {
@@ -72,6 +72,8 @@ void Cylinder::commit()
         return float4(v, radius ? radius[rID++ / 2] : m_globalRadius);
       });
     }
+
+    computeBounds(vr, numCylinders * 2);
   }
 
   {
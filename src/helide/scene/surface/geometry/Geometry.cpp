@@ -9,6 +9,8 @@
 #include "Quad.h"
 #include "Sphere.h"
 #include "Triangle.h"
+// embree
+#include "algorithms/parallel_reduce.h"
 // std
 #include <cstring>
 #include <limits>
@@ -48,6 +50,7 @@ RTCGeometry Geometry::embreeGeometry() const
 
 void Geometry::commit()
 {
+  m_bounds = box3();
   m_uniformAttr[0] = getParam<float4>("attribute0", DEFAULT_ATTRIBUTE_VALUE);
   m_uniformAttr[1] = getParam<float4>("attribute1", DEFAULT_ATTRIBUTE_VALUE);
   m_uniformAttr[2] = getParam<float4>("attribute2", DEFAULT_ATTRIBUTE_VALUE);
@@ -77,6 +80,41 @@ float4 Geometry::getAttributeValue(const Attribute &attr, const Ray &ray) const
       m_primitiveAttr[attrIdx].ptr, ray.primID, m_uniformAttr[attrIdx]);
 }
 
+box3 Geometry::bounds() const
+{
+  return m_bounds;
+}
+
+template <typename T, typename BOUNDS_FCN_T>
+static box3 reduceBounds(const T *items, size_t count, BOUNDS_FCN_T &&boundsOf)
+{
+  return embree::parallel_reduce(size_t(0),
+      count,
+      size_t(4096),
+      box3(),
+      [&](const embree::range<size_t> &r) {
+        box3 b;
+        for (size_t i = r.begin(); i < r.end(); i++)
+          b.extend(boundsOf(items[i]));
+        return b;
+      },
+      [](box3 a, const box3 &b) { return a.extend(b); });
+}
+
+void Geometry::computeBounds(const float3 *positions, size_t count)
+{
+  m_bounds = reduceBounds(
+      positions, count, [](const float3 &p) { return box3(p, p); });
+}
+
+void Geometry::computeBounds(const float4 *spheres, size_t count)
+{
+  m_bounds = reduceBounds(spheres, count, [](const float4 &s) {
+    const float3 c(s.x, s.y, s.z);
+    return box3(c - s.w, c + s.w);
+  });
+}
+
 } // namespace helide
 
 HELIDE_ANARI_TYPEFOR_DEFINITION(helide::Geometry *);
@@ -25,8 +25,17 @@ struct Geometry : public Object
 
   virtual float4 getAttributeValue(const Attribute &attr, const Ray &ray) const;
 
+  // Object-space bounds of all primitives, cached when committed so they can
+  // be queried without building a BVH
+  box3 bounds() const;
+
  protected:
+  // Parallel reductions over vertex data, for subtypes to call from commit()
+  void computeBounds(const float3 *positions, size_t count);
+  void computeBounds(const float4 *spheres, size_t count); // (center, radius)
+
   RTCGeometry m_embreeGeometry{nullptr};
+  box3 m_bounds;
 
   std::array<float4, 5> m_uniformAttr;
   std::array<helium::IntrusivePtr<Array1D>, 5> m_primitiveAttr;
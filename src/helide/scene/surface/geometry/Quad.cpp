@@ -45,6 +45,9 @@ void Quad::commit()
       sizeof(float3),
       m_vertexPosition->size());
 
+  computeBounds(
+      m_vertexPosition->beginAs<float3>(), m_vertexPosition->size());
+
   if (m_index) {
     rtcSetSharedGeometryBuffer(embreeGeometry(),
         RTC_BUFFER_TYPE_INDEX,
@@ -80,6 +80,8 @@ void Sphere::commit()
     });
   }
 
+  computeBounds(vr, numSpheres);
+
   rtcCommitGeometry(embreeGeometry());
 }
 
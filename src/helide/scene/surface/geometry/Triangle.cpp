@@ -46,6 +46,9 @@ void Triangle::commit()
       sizeof(float3),
       m_vertexPosition->size());
 
+  computeBounds(
+      m_vertexPosition->beginAs<float3>(), m_vertexPosition->size());
+
   if (m_index) {
     rtcSetSharedGeometryBuffer(embreeGeometry(),
         RTC_BUFFER_TYPE_INDEX,
@@ -8,7 +8,49 @@
 
 namespace helide {
 
-Material::Material(HelideGlobalState *s) : Object(ANARI_MATERIAL, s) {}
+// Helper functions ///////////////////////////////////////////////////////////
+
+static MaterialSource samplerSource(const Sampler *s)
+{
+  if (dynamic_cast<const Image1D *>(s))
+    return MaterialSource::IMAGE1D;
+  else if (dynamic_cast<const Image2D *>(s))
+    return MaterialSource::IMAGE2D;
+  else if (dynamic_cast<const Image3D *>(s))
+    return MaterialSource::IMAGE3D;
+  else if (dynamic_cast<const PrimitiveSampler *>(s))
+    return MaterialSource::PRIMITIVE;
+  else if (dynamic_cast<const TransformSampler *>(s))
+    return MaterialSource::TRANSFORM;
+  else
+    return MaterialSource::CONSTANT;
+}
+
+static MaterialSource shadingSource(const Sampler *s, Attribute attr)
+{
+  if (s && s->isValid()) {
+    const auto source = samplerSource(s);
+    if (source != MaterialSource::CONSTANT)
+      return source;
+  }
+  return attr == Attribute::NONE ? MaterialSource::CONSTANT
+                                 : MaterialSource::ATTRIBUTE;
+}
+
+// Material definitions ///////////////////////////////////////////////////////
+
+Material::Material(HelideGlobalState *s) : Object(ANARI_MATERIAL, s)
+{
+  resolveShadingSources();
+}
+
+Material::~Material()
+{
+  if (m_colorSampler)
+    m_colorSampler->removeCommitObserver(this);
+  if (m_opacitySampler)
+    m_opacitySampler->removeCommitObserver(this);
+}
 
 Material *Material::createInstance(
     std::string_view subtype, HelideGlobalState *s)
@@ -23,10 +65,34 @@ Material *Material::createInstance(
 
 void Material::commit()
 {
+  if (m_colorSampler)
+    m_colorSampler->removeCommitObserver(this);
+  if (m_opacitySampler)
+    m_opacitySampler->removeCommitObserver(this);
+
   m_alphaMode = alphaModeFromString(getParamString("alphaMode", "opaque"));
   m_alphaCutoff = getParam<float>("alphaCutoff", 0.5f);
 }
 
+void Material::markCommitted()
+{
+  // Subtypes have finished reading their color/opacity sources by now
+  resolveShadingSources();
+
+  if (m_colorSampler)
+    m_colorSampler->addCommitObserver(this);
+  if (m_opacitySampler)
+    m_opacitySampler->addCommitObserver(this);
+
+  Object::markCommitted();
+}
+
+void Material::resolveShadingSources()
+{
+  m_colorSource = shadingSource(m_colorSampler.ptr, m_colorAttribute);
+  m_opacitySource = shadingSource(m_opacitySampler.ptr, m_opacityAttribute);
+}
+
 } // namespace helide
 
 HELIDE_ANARI_TYPEFOR_DEFINITION(helide::Material *);
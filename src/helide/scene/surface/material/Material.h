@@ -4,19 +4,42 @@
 #pragma once
 
 #include "Object.h"
-#include "sampler/Sampler.h"
+#include "scene/surface/geometry/Geometry.h"
+#include "sampler/Image1D.h"
+#include "sampler/Image2D.h"
+#include "sampler/Image3D.h"
+#include "sampler/PrimitiveSampler.h"
+#include "sampler/TransformSampler.h"
 
 namespace helide {
 
+// Where a material's color or opacity comes from, resolved once per commit
+// so per-hit lookups are a switch which inlines into the renderer's shading
+// kernels instead of an indirect call.
+enum class MaterialSource
+{
+  CONSTANT,
+  ATTRIBUTE,
+  IMAGE1D,
+  IMAGE2D,
+  IMAGE3D,
+  PRIMITIVE,
+  TRANSFORM
+};
+
 struct Material : public Object
 {
   Material(HelideGlobalState *s);
-  ~Material() override = default;
+  ~Material() override;
 
   static Material *createInstance(
       std::string_view subtype, HelideGlobalState *s);
 
   void commit() override;
+  void markCommitted() override;
+
+  float4 getSurfaceColor(const Geometry &g, const Ray &r) const;
+  float getSurfaceOpacity(const Geometry &g, const Ray &r) const;
 
   float4 color() const;
   Attribute colorAttribute() const;
@@ -40,10 +63,65 @@ struct Material : public Object
   float m_alphaCutoff{0.5f};
 
   AlphaMode m_alphaMode{AlphaMode::OPAQUE};
+
+ private:
+  void resolveShadingSources();
+
+  MaterialSource m_colorSource{MaterialSource::CONSTANT};
+  MaterialSource m_opacitySource{MaterialSource::CONSTANT};
 };
 
+// Qualified call: the sampler subtype is known, so skip virtual dispatch
+template <typename SAMPLER_T>
+inline float4 sampleFrom(const Sampler *s, const Geometry &g, const Ray &r)
+{
+  return static_cast<const SAMPLER_T *>(s)->SAMPLER_T::getSample(g, r);
+}
+
+inline float4 sampleFrom(
+    MaterialSource source, const Sampler *s, const Geometry &g, const Ray &r)
+{
+  switch (source) {
+  case MaterialSource::IMAGE1D:
+    return sampleFrom<Image1D>(s, g, r);
+  case MaterialSource::IMAGE2D:
+    return sampleFrom<Image2D>(s, g, r);
+  case MaterialSource::IMAGE3D:
+    return sampleFrom<Image3D>(s, g, r);
+  case MaterialSource::PRIMITIVE:
+    return sampleFrom<PrimitiveSampler>(s, g, r);
+  case MaterialSource::TRANSFORM:
+  default:
+    return sampleFrom<TransformSampler>(s, g, r);
+  }
+}
+
 // Inlined definitions ////////////////////////////////////////////////////////
 
+inline float4 Material::getSurfaceColor(const Geometry &g, const Ray &r) const
+{
+  switch (m_colorSource) {
+  case MaterialSource::CONSTANT:
+    return m_color;
+  case MaterialSource::ATTRIBUTE:
+    return g.getAttributeValue(m_colorAttribute, r);
+  default:
+    return sampleFrom(m_colorSource, m_colorSampler.ptr, g, r);
+  }
+}
+
+inline float Material::getSurfaceOpacity(const Geometry &g, const Ray &r) const
+{
+  switch (m_opacitySource) {
+  case MaterialSource::CONSTANT:
+    return m_opacity;
+  case MaterialSource::ATTRIBUTE:
+    return g.getAttributeValue(m_opacityAttribute, r).x;
+  default:
+    return sampleFrom(m_opacitySource, m_opacitySampler.ptr, g, r).x;
+  }
+}
+
 inline float4 Material::color() const
 {
   return m_color;
@@ -8,15 +8,63 @@ namespace helide {
 
 Image2D::Image2D(HelideGlobalState *s) : Sampler(s) {}
 
+Image2D::~Image2D()
+{
+  cleanup();
+}
+
 bool Image2D::isValid() const
 {
-  return Sampler::isValid() && m_image;
+  return Sampler::isValid() && (m_image || m_virtualTexture);
+}
+
+bool Image2D::getProperty(
+    const std::string_view &name, ANARIDataType type, void *ptr, uint32_t flags)
+{
+  if (type == ANARI_UINT64 && name.substr(0, 9) == "tileCache") {
+    const auto stats =
+        m_virtualTexture ? m_virtualTexture->stats() : VirtualTexture2DStats{};
+    if (name == "tileCacheHits")
+      helium::writeToVoidP(ptr, stats.hits);
+    else if (name == "tileCacheMisses")
+      helium::writeToVoidP(ptr, stats.misses);
+    else if (name == "tileCacheEvictions")
+      helium::writeToVoidP(ptr, stats.evictions);
+    else if (name == "tileCacheResidentTiles")
+      helium::writeToVoidP(ptr, stats.residentTiles);
+    else if (name == "tileCacheResidentBytes")
+      helium::writeToVoidP(ptr, stats.residentBytes);
+    else if (name == "tileCacheReadFailures")
+      helium::writeToVoidP(ptr, stats.readFailures);
+    else
+      return Sampler::getProperty(name, type, ptr, flags);
+    return true;
+  }
+
+  return Sampler::getProperty(name, type, ptr, flags);
 }
 
 void Image2D::commit()
 {
   Sampler::commit();
+
+  cleanup();
+
   m_image = getParamObject<Array2D>("image");
+
+  ANARIDataType elementType = ANARI_UNKNOWN;
+  uint2 size(0u);
+  if (auto source = makeTileSource(elementType, size)) {
+    m_virtualTexture = std::make_unique<VirtualTexture2D>(std::move(source),
+        elementType,
+        size,
+        getParam<uint32_t>("tileSize", 64),
+        getParam<uint64_t>("tileCacheSize", uint64_t(64) << 20));
+  }
+
+  if (m_image)
+    m_image->addCommitObserver(this);
+
   m_inAttribute =
       attributeFromString(getParamString("inAttribute", "attribute0"));
   m_linearFilter = getParamString("filter", "linear") != "nearest";
@@ -36,16 +84,13 @@ float4 Image2D::getSample(const Geometry &g, const Ray &r) const
   auto av = linalg::mul(m_inTransform, g.getAttributeValue(m_inAttribute, r))
       + m_inOffset;
 
-  const auto interp_x = getInterpolant(av.x, m_image->size().x, true);
-  const auto interp_y = getInterpolant(av.y, m_image->size().y, true);
-  const auto v00 = m_image->readAsAttributeValue(
-      {interp_x.lower, interp_y.lower}, m_wrapMode1, m_wrapMode2);
-  const auto v01 = m_image->readAsAttributeValue(
-      {interp_x.lower, interp_y.upper}, m_wrapMode1, m_wrapMode2);
-  const auto v10 = m_image->readAsAttributeValue(
-      {interp_x.upper, interp_y.lower}, m_wrapMode1, m_wrapMode2);
-  const auto v11 = m_image->readAsAttributeValue(
-      {interp_x.upper, interp_y.upper}, m_wrapMode1, m_wrapMode2);
+  const auto size = imageSize();
+  const auto interp_x = getInterpolant(av.x, size.x, true);
+  const auto interp_y = getInterpolant(av.y, size.y, true);
+  const auto v00 = readTexel({interp_x.lower, interp_y.lower});
+  const auto v01 = readTexel({interp_x.lower, interp_y.upper});
+  const auto v10 = readTexel({interp_x.upper, interp_y.lower});
+  const auto v11 = readTexel({interp_x.upper, interp_y.upper});
 
   const auto v0 = m_linearFilter ? linalg::lerp(v00, v01, interp_y.frac)
                                  : (interp_y.frac < 0.5f ? v00 : v01);
@@ -58,4 +103,66 @@ float4 Image2D::getSample(const Geometry &g, const Ray &r) const
   return linalg::mul(m_outTransform, retval) + m_outOffset;
 }
 
+uint2 Image2D::imageSize() const
+{
+  return m_virtualTexture ? m_virtualTexture->size() : m_image->size();
+}
+
+float4 Image2D::readTexel(const int2 &i) const
+{
+  if (!m_virtualTexture)
+    return m_image->readAsAttributeValue(i, m_wrapMode1, m_wrapMode2);
+
+  const auto size = m_virtualTexture->size();
+  const auto i_x = calculateWrapIndex(i.x, size.x, m_wrapMode1);
+  const auto i_y = calculateWrapIndex(i.y, size.y, m_wrapMode2);
+  return m_virtualTexture->texel(uint2(i_x, i_y));
+}
+
+std::unique_ptr<TileSource> Image2D::makeTileSource(
+    ANARIDataType &elementType, uint2 &size)
+{
+  HelideTileReadCallback callback = nullptr;
+  getParam("tileCallback", ANARI_FUNCTION_POINTER, &callback);
+  const auto filename = getParamString("filename", "");
+
+  // A resident 'image' is always sampled directly, paging it through the
+  // tile cache would only add a second copy of the texels
+  if (m_image || (!callback && filename.empty()))
+    return {};
+
+  elementType = getParam<anari::DataType>("imageFormat", ANARI_UNKNOWN);
+  size = getParam<uint2>("imageSize", uint2(0u));
+  if (anari::sizeOf(elementType) == 0 || size.x == 0 || size.y == 0) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "tiled image2D sampler requires valid 'imageFormat' and 'imageSize'");
+    return {};
+  }
+
+  if (callback) {
+    return std::make_unique<CallbackTileSource>(
+        callback, getParam<void *>("tileCallbackUserData", nullptr));
+  }
+
+  auto fileSource = std::make_unique<FileTileSource>(filename,
+      getParam<uint64_t>("fileOffset", 0),
+      size,
+      anari::sizeOf(elementType));
+  if (!fileSource->isOpen()) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "unable to open '%s' (or file too small) for tiled image2D sampler",
+        filename.c_str());
+    return {};
+  }
+
+  return fileSource;
+}
+
+void Image2D::cleanup()
+{
+  if (m_image)
+    m_image->removeCommitObserver(this);
+  m_virtualTexture.reset();
+}
+
 } // namespace helide
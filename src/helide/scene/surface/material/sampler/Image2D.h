@@ -4,6 +4,7 @@
 #pragma once
 
 #include "Sampler.h"
+#include "VirtualTexture2D.h"
 #include "array/Array2D.h"
 
 namespace helide {
@@ -11,14 +12,26 @@ namespace helide {
 struct Image2D : public Sampler
 {
   Image2D(HelideGlobalState *d);
+  ~Image2D() override;
 
   bool isValid() const override;
+  bool getProperty(const std::string_view &name,
+      ANARIDataType type,
+      void *ptr,
+      uint32_t flags) override;
   void commit() override;
 
   float4 getSample(const Geometry &g, const Ray &r) const override;
 
  private:
+  uint2 imageSize() const;
+  float4 readTexel(const int2 &i) const;
+  std::unique_ptr<TileSource> makeTileSource(
+      ANARIDataType &elementType, uint2 &imageSize);
+  void cleanup();
+
   helium::IntrusivePtr<Array2D> m_image;
+  std::unique_ptr<VirtualTexture2D> m_virtualTexture;
   Attribute m_inAttribute{Attribute::NONE};
   WrapMode m_wrapMode1{WrapMode::DEFAULT};
   WrapMode m_wrapMode2{WrapMode::DEFAULT};
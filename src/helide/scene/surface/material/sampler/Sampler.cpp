@@ -29,6 +29,17 @@ Sampler *Sampler::createInstance(std::string_view subtype, HelideGlobalState *s)
     return (Sampler *)new UnknownObject(ANARI_SAMPLER, s);
 }
 
+void Sampler::markCommitted()
+{
+  Object::markCommitted();
+  notifyCommitObservers();
+}
+
+void Sampler::notifyObserver(helium::BaseObject *obj) const
+{
+  queueObserverCommit(obj);
+}
+
 } // namespace helide
 
 HELIDE_ANARI_TYPEFOR_DEFINITION(helide::Sampler *);
@@ -16,8 +16,15 @@ struct Sampler : public Object
 
   virtual float4 getSample(const Geometry &g, const Ray &r) const = 0;
 
+  // Materials pick their color/opacity sources from their samplers, so let
+  // them know when a sampler's validity may have changed.
+  void markCommitted() override;
+
   static Sampler *createInstance(
       std::string_view subtype, HelideGlobalState *d);
+
+ protected:
+  void notifyObserver(helium::BaseObject *obj) const override;
 };
 
 } // namespace helide
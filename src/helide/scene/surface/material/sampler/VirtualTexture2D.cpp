@@ -0,0 +1,229 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "VirtualTexture2D.h"
+// std
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace helide {
+
+// CallbackTileSource definitions /////////////////////////////////////////////
+
+CallbackTileSource::CallbackTileSource(
+    HelideTileReadCallback cb, const void *userData)
+    : m_callback(cb), m_userData(userData)
+{}
+
+bool CallbackTileSource::readRegion(
+    const uint2 &origin, const uint2 &size, size_t rowPitch, void *dst)
+{
+  return m_callback(
+             m_userData, origin.x, origin.y, size.x, size.y, rowPitch, dst)
+      != 0;
+}
+
+// FileTileSource definitions /////////////////////////////////////////////////
+
+FileTileSource::FileTileSource(const std::string &filename,
+    size_t offset,
+    const uint2 &imageSize,
+    size_t elementSize)
+    : m_filename(filename),
+      m_offset(offset),
+      m_imageSize(imageSize),
+      m_elementSize(elementSize)
+{
+#ifndef _WIN32
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    return;
+
+  struct stat sb;
+  if (fstat(fd, &sb) == 0 && sb.st_size > 0) {
+    void *p = mmap(nullptr, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p != MAP_FAILED) {
+      m_mapped = (const uint8_t *)p;
+      m_fileSize = sb.st_size;
+    }
+  }
+
+  close(fd);
+#else
+  std::ifstream f(filename, std::ios::binary | std::ios::ate);
+  if (f)
+    m_fileSize = f.tellg();
+#endif
+}
+
+FileTileSource::~FileTileSource()
+{
+#ifndef _WIN32
+  if (m_mapped)
+    munmap((void *)m_mapped, m_fileSize);
+#endif
+}
+
+bool FileTileSource::isOpen() const
+{
+  const size_t requiredBytes = m_offset
+      + size_t(m_imageSize.x) * size_t(m_imageSize.y) * m_elementSize;
+  return m_fileSize != 0 && m_fileSize >= requiredBytes;
+}
+
+bool FileTileSource::readRegion(
+    const uint2 &origin, const uint2 &size, size_t rowPitch, void *dst)
+{
+  const size_t srcPitch = m_imageSize.x * m_elementSize;
+  const size_t rowBytes = size.x * m_elementSize;
+
+  if (m_mapped) {
+    const uint8_t *src =
+        m_mapped + m_offset + origin.y * srcPitch + origin.x * m_elementSize;
+    for (uint32_t y = 0; y < size.y; y++)
+      std::memcpy((uint8_t *)dst + y * rowPitch, src + y * srcPitch, rowBytes);
+    return true;
+  }
+
+  std::lock_guard<std::mutex> lock(m_readMutex);
+  std::ifstream f(m_filename, std::ios::binary);
+  if (!f)
+    return false;
+
+  for (uint32_t y = 0; y < size.y; y++) {
+    f.seekg(m_offset + (origin.y + y) * srcPitch + origin.x * m_elementSize);
+    f.read((char *)dst + y * rowPitch, rowBytes);
+  }
+
+  return bool(f);
+}
+
+// VirtualTexture2D definitions ///////////////////////////////////////////////
+
+VirtualTexture2D::VirtualTexture2D(std::unique_ptr<TileSource> source,
+    ANARIDataType elementType,
+    const uint2 &imageSize,
+    uint32_t tileSize,
+    size_t cacheBudgetBytes)
+    : m_source(std::move(source)),
+      m_elementType(elementType),
+      m_elementSize(anari::sizeOf(elementType)),
+      m_imageSize(imageSize),
+      m_tileSize(std::max(tileSize, 1u))
+{
+  m_numTiles = (m_imageSize + (m_tileSize - 1)) / m_tileSize;
+  const size_t tileBytes = size_t(m_tileSize) * m_tileSize * m_elementSize;
+  m_maxResidentTiles = std::max(cacheBudgetBytes / tileBytes, size_t(1));
+  m_emptyTile = std::make_shared<std::vector<uint8_t>>(tileBytes, 0);
+}
+
+VirtualTexture2DStats VirtualTexture2D::stats() const
+{
+  VirtualTexture2DStats s;
+  s.hits = m_hits.load();
+  s.misses = m_misses.load();
+  s.evictions = m_evictions.load();
+  s.readFailures = m_readFailures.load();
+
+  std::lock_guard<std::mutex> lock(m_replacementMutex);
+  s.residentTiles = m_replacementQueue.size();
+  s.residentBytes =
+      s.residentTiles * size_t(m_tileSize) * m_tileSize * m_elementSize;
+  return s;
+}
+
+VirtualTexture2D::TileData VirtualTexture2D::fetchTile(
+    const uint2 &tileID) const
+{
+  const uint64_t key = uint64_t(tileID.y) * m_numTiles.x + tileID.x;
+  auto &shard = shardOf(key);
+
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto found = shard.tiles.find(key);
+    if (found != shard.tiles.end()) {
+      found->second.referenced.store(true, std::memory_order_relaxed);
+      m_hits++;
+      return found->second.data;
+    }
+  }
+
+  // Page in without holding any lock so other threads can keep sampling
+  // resident tiles while (potentially slow) tile reads are in flight.
+  m_misses++;
+  auto tile = loadTile(tileID);
+  if (!tile) {
+    m_readFailures++;
+    return m_emptyTile; // not cached, the read is retried on the next touch
+  }
+
+  std::lock_guard<std::mutex> replacementLock(m_replacementMutex);
+
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto found = shard.tiles.find(key);
+    if (found != shard.tiles.end()) // another thread won the race
+      return found->second.data;
+  }
+
+  while (m_replacementQueue.size() >= m_maxResidentTiles)
+    evictTile();
+
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.tiles.try_emplace(key).first->second.data = tile;
+  }
+
+  m_replacementQueue.push_back(key);
+  return tile;
+}
+
+VirtualTexture2D::TileData VirtualTexture2D::loadTile(
+    const uint2 &tileID) const
+{
+  const size_t rowPitch = size_t(m_tileSize) * m_elementSize;
+  auto tile = std::make_shared<std::vector<uint8_t>>(rowPitch * m_tileSize, 0);
+
+  const uint2 origin = tileID * m_tileSize;
+  const uint2 extent = linalg::min(uint2(m_tileSize), m_imageSize - origin);
+  if (!m_source->readRegion(origin, extent, rowPitch, tile->data()))
+    return {};
+
+  return tile;
+}
+
+void VirtualTexture2D::evictTile() const
+{
+  // Called with 'm_replacementMutex' held. Every pass over the queue clears
+  // the referenced flags it skips, so this terminates within two passes.
+  while (!m_replacementQueue.empty()) {
+    const uint64_t key = m_replacementQueue.front();
+    m_replacementQueue.pop_front();
+
+    auto &shard = shardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto found = shard.tiles.find(key);
+    if (found->second.referenced.exchange(false, std::memory_order_relaxed)) {
+      m_replacementQueue.push_back(key);
+      continue;
+    }
+
+    shard.tiles.erase(found);
+    m_evictions++;
+    return;
+  }
+}
+
+VirtualTexture2D::Shard &VirtualTexture2D::shardOf(uint64_t key) const
+{
+  return m_shards[key % NUM_SHARDS];
+}
+
+} // namespace helide
@@ -0,0 +1,166 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "HelideMath.h"
+// helide
+#include "anari/ext/helide/helideTileReadCallback.h"
+// std
+#include <array>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace helide {
+
+// Tile sources ///////////////////////////////////////////////////////////////
+
+// Produces the texels of a rectangular region of a 2D image on demand. The
+// region is written row-by-row into 'dst' with 'rowPitch' bytes between rows.
+struct TileSource
+{
+  virtual ~TileSource() = default;
+  virtual bool readRegion(
+      const uint2 &origin, const uint2 &size, size_t rowPitch, void *dst) = 0;
+};
+
+struct CallbackTileSource : public TileSource
+{
+  CallbackTileSource(HelideTileReadCallback cb, const void *userData);
+  bool readRegion(const uint2 &origin,
+      const uint2 &size,
+      size_t rowPitch,
+      void *dst) override;
+
+ private:
+  HelideTileReadCallback m_callback{nullptr};
+  const void *m_userData{nullptr};
+};
+
+struct FileTileSource : public TileSource
+{
+  FileTileSource(const std::string &filename,
+      size_t offset,
+      const uint2 &imageSize,
+      size_t elementSize);
+  ~FileTileSource() override;
+
+  bool isOpen() const;
+
+  bool readRegion(const uint2 &origin,
+      const uint2 &size,
+      size_t rowPitch,
+      void *dst) override;
+
+ private:
+  std::string m_filename;
+  size_t m_offset{0};
+  uint2 m_imageSize{0u};
+  size_t m_elementSize{0};
+  size_t m_fileSize{0};
+  const uint8_t *m_mapped{nullptr};
+  std::mutex m_readMutex; // only used when memory mapping is unavailable
+};
+
+// Paged, fixed-budget 2D texture /////////////////////////////////////////////
+
+struct VirtualTexture2DStats
+{
+  uint64_t hits{0};
+  uint64_t misses{0};
+  uint64_t evictions{0};
+  uint64_t residentTiles{0};
+  uint64_t residentBytes{0};
+  uint64_t readFailures{0};
+};
+
+struct VirtualTexture2D
+{
+  VirtualTexture2D(std::unique_ptr<TileSource> source,
+      ANARIDataType elementType,
+      const uint2 &imageSize,
+      uint32_t tileSize,
+      size_t cacheBudgetBytes);
+
+  uint2 size() const;
+  ANARIDataType elementType() const;
+
+  // Read a single texel, paging in its tile if it is not resident. The index
+  // must already be wrapped into the image bounds.
+  float4 texel(const uint2 &i) const;
+
+  VirtualTexture2DStats stats() const;
+
+ private:
+  using TileData = std::shared_ptr<const std::vector<uint8_t>>;
+
+  // Hits only take the lock of the shard a tile hashes to and mark the tile
+  // as referenced, the replacement order is only touched on misses
+  static constexpr size_t NUM_SHARDS = 32;
+
+  struct ResidentTile
+  {
+    TileData data;
+    std::atomic<bool> referenced{true};
+  };
+
+  struct Shard
+  {
+    std::mutex mutex;
+    std::unordered_map<uint64_t, ResidentTile> tiles;
+  };
+
+  TileData fetchTile(const uint2 &tileID) const;
+  TileData loadTile(const uint2 &tileID) const;
+  void evictTile() const;
+  Shard &shardOf(uint64_t key) const;
+
+  std::unique_ptr<TileSource> m_source;
+  ANARIDataType m_elementType{ANARI_UNKNOWN};
+  size_t m_elementSize{0};
+  uint2 m_imageSize{0u};
+  uint32_t m_tileSize{64};
+  uint2 m_numTiles{0u};
+  size_t m_maxResidentTiles{1};
+  TileData m_emptyTile; // returned for tiles which could not be read
+
+  mutable std::array<Shard, NUM_SHARDS> m_shards;
+
+  // Resident tiles in the order they were paged in, evicted with a second
+  // chance for tiles referenced since they were last considered (CLOCK)
+  mutable std::mutex m_replacementMutex;
+  mutable std::deque<uint64_t> m_replacementQueue;
+
+  mutable std::atomic<uint64_t> m_hits{0};
+  mutable std::atomic<uint64_t> m_misses{0};
+  mutable std::atomic<uint64_t> m_evictions{0};
+  mutable std::atomic<uint64_t> m_readFailures{0};
+};
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+inline uint2 VirtualTexture2D::size() const
+{
+  return m_imageSize;
+}
+
+inline ANARIDataType VirtualTexture2D::elementType() const
+{
+  return m_elementType;
+}
+
+inline float4 VirtualTexture2D::texel(const uint2 &i) const
+{
+  const uint2 tileID = i / m_tileSize;
+  const uint2 local = i - tileID * m_tileSize;
+  auto tile = fetchTile(tileID);
+  return readAsAttributeValueFlat(
+      tile->data(), m_elementType, size_t(local.y) * m_tileSize + local.x);
+}
+
+} // namespace helide
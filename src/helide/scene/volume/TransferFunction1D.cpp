@@ -65,17 +65,25 @@ void TransferFunction1D::render(
   currentInterval.lower += stepSize * jitter;
 
   while (opacity < 0.99f && size(currentInterval) >= 0.f) {
-    const float3 p = vray.org + vray.dir * currentInterval.lower;
-    const float s = field()->sampleAt(p);
+    const float t = currentInterval.lower;
+    const float3 p = vray.org + vray.dir * t;
+
+    // Coarser levels are sampled with proportionally longer steps
+    const float level =
+        field()->levelOfDetail(vray.spreadWidth + vray.spreadAngle * t);
+    const float s = field()->sampleAtLevel(p, level);
+    const float stepScale = level > 0.f ? std::exp2(level) : 1.f;
 
     if (!std::isnan(s)) {
       const float3 c = colorOf(s);
-      const float o = opacityOf(s) * m_densityScale;
+      float o = opacityOf(s) * m_densityScale;
+      if (stepScale != 1.f)
+        o = 1.f - std::pow(1.f - std::min(o, 1.f), stepScale);
       accumulateValue(color, c * o, opacity);
       accumulateValue(opacity, o, opacity);
     }
 
-    currentInterval.lower += stepSize;
+    currentInterval.lower += stepSize * stepScale;
   }
 }
 
@@ -20,6 +20,16 @@ SpatialField *SpatialField::createInstance(
     return (SpatialField *)new UnknownObject(ANARI_SPATIAL_FIELD, s);
 }
 
+float SpatialField::levelOfDetail(float) const
+{
+  return 0.f;
+}
+
+float SpatialField::sampleAtLevel(const float3 &coord, float) const
+{
+  return sampleAt(coord);
+}
+
 void SpatialField::setStepSize(float size)
 {
   m_stepSize = size;
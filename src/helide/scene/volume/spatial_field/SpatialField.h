@@ -16,6 +16,16 @@ struct SpatialField : public Object
 
   virtual float sampleAt(const float3 &coord) const = 0;
 
+  // Level of detail whose voxels best match a footprint 'width' object units
+  // wide, where 0 is full resolution. Fields without coarser representations
+  // always return 0. NOTE: the footprint is measured along the world space
+  // ray, which only matches object units because volume rays are not (yet)
+  // transformed by their instance.
+  virtual float levelOfDetail(float width) const;
+
+  // Sample at a (fractional) level of detail returned by levelOfDetail()
+  virtual float sampleAtLevel(const float3 &coord, float level) const;
+
   virtual box3 bounds() const = 0;
 
   float stepSize() const;
@@ -2,17 +2,61 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "StructuredRegularField.h"
+#include "HelideGlobalState.h"
+// embree
+#include "algorithms/parallel_for.h"
 // std
+#include <cmath>
 #include <limits>
 
 namespace helide {
 
+// Trilinear interpolation between the voxels 'vi0' and 'vi1' read by 'value'
+template <typename VALUE_FCN_T>
+static float trilinear(const uint3 &vi0,
+    const uint3 &vi1,
+    const float3 &fracLocal,
+    VALUE_FCN_T &&value)
+{
+  const float voxel_000 = value(uint3(vi0.x, vi0.y, vi0.z));
+  const float voxel_001 = value(uint3(vi1.x, vi0.y, vi0.z));
+  const float voxel_010 = value(uint3(vi0.x, vi1.y, vi0.z));
+  const float voxel_011 = value(uint3(vi1.x, vi1.y, vi0.z));
+  const float voxel_100 = value(uint3(vi0.x, vi0.y, vi1.z));
+  const float voxel_101 = value(uint3(vi1.x, vi0.y, vi1.z));
+  const float voxel_110 = value(uint3(vi0.x, vi1.y, vi1.z));
+  const float voxel_111 = value(uint3(vi1.x, vi1.y, vi1.z));
+
+  const float voxel_00 = linalg::lerp(voxel_000, voxel_001, fracLocal.x);
+  const float voxel_01 = linalg::lerp(voxel_010, voxel_011, fracLocal.x);
+  const float voxel_10 = linalg::lerp(voxel_100, voxel_101, fracLocal.x);
+  const float voxel_11 = linalg::lerp(voxel_110, voxel_111, fracLocal.x);
+  const float voxel_0 = linalg::lerp(voxel_00, voxel_01, fracLocal.y);
+  const float voxel_1 = linalg::lerp(voxel_10, voxel_11, fracLocal.y);
+
+  return linalg::lerp(voxel_0, voxel_1, fracLocal.z);
+}
+
+static size_t linearIndex(const uint3 &index, const uint3 &dims)
+{
+  return size_t(index.x) + dims.x * (size_t(index.y) + dims.y * size_t(index.z));
+}
+
 StructuredRegularField::StructuredRegularField(HelideGlobalState *d)
     : SpatialField(d)
 {}
 
+StructuredRegularField::~StructuredRegularField()
+{
+  waitForLevelsOfDetail();
+}
+
 void StructuredRegularField::commit()
 {
+  waitForLevelsOfDetail();
+  m_numLevels = 1;
+  m_levels.clear();
+
   m_dataArray = getParamObject<Array3D>("data");
 
   if (!m_dataArray) {
@@ -34,6 +78,21 @@ void StructuredRegularField::commit()
       std::nextafter(m_dims.z - 1, 0));
 
   setStepSize(linalg::minelem(m_spacing / 2.f));
+
+  m_lodBias = getParam<float>("levelOfDetailBias", 0.f);
+  if (!getParam<bool>("levelOfDetail", false))
+    return;
+
+  if (getParam<bool>("levelOfDetailAsync", false)) {
+    // Render from the full resolution data until the pyramid is ready
+    m_levelBuild = std::async(std::launch::async, [this]() {
+      auto &epochs = deviceState()->epochs;
+      const auto epoch = epochs.pin();
+      buildLevelsOfDetail();
+      epochs.unpin(epoch);
+    });
+  } else
+    buildLevelsOfDetail();
 }
 
 bool StructuredRegularField::isValid() const
@@ -44,38 +103,42 @@ bool StructuredRegularField::isValid() const
 float StructuredRegularField::sampleAt(const float3 &coord) const
 {
   const float3 local = objectToLocal(coord);
+  return inBounds(local) ? sampleLocal(local) : NAN;
+}
 
-  if (local.x < 0.f || local.x > m_dims.x - 1.f || local.y < 0.f
-      || local.y > m_dims.y - 1.f || local.z < 0.f
-      || local.z > m_dims.z - 1.f) {
-    return NAN;
-  }
+float StructuredRegularField::levelOfDetail(float width) const
+{
+  const uint32_t numLevels = m_numLevels.load(std::memory_order_acquire);
+  if (numLevels < 2 || width <= 0.f)
+    return 0.f;
 
-  const float3 clampedLocal =
-      linalg::clamp(local, float3(0.f), m_coordUpperBound);
+  const float level =
+      std::log2(width / linalg::minelem(m_spacing)) + m_lodBias;
+  return std::clamp(level, 0.f, float(numLevels - 1));
+}
 
-  const uint3 vi0 = uint3(clampedLocal);
-  const uint3 vi1 = linalg::clamp(vi0 + 1, uint3(0u), m_dims - 1);
+float StructuredRegularField::sampleAtLevel(
+    const float3 &coord, float level) const
+{
+  const float3 local = objectToLocal(coord);
+  if (!inBounds(local))
+    return NAN;
 
-  const float3 fracLocal = clampedLocal - float3(vi0);
+  const uint32_t numLevels = m_numLevels.load(std::memory_order_acquire);
+  level = std::clamp(level, 0.f, float(numLevels - 1));
 
-  const float voxel_000 = valueAtVoxel(uint3(vi0.x, vi0.y, vi0.z));
-  const float voxel_001 = valueAtVoxel(uint3(vi1.x, vi0.y, vi0.z));
-  const float voxel_010 = valueAtVoxel(uint3(vi0.x, vi1.y, vi0.z));
-  const float voxel_011 = valueAtVoxel(uint3(vi1.x, vi1.y, vi0.z));
-  const float voxel_100 = valueAtVoxel(uint3(vi0.x, vi0.y, vi1.z));
-  const float voxel_101 = valueAtVoxel(uint3(vi1.x, vi0.y, vi1.z));
-  const float voxel_110 = valueAtVoxel(uint3(vi0.x, vi1.y, vi1.z));
-  const float voxel_111 = valueAtVoxel(uint3(vi1.x, vi1.y, vi1.z));
+  // Blend the two nearest levels so switching between them does not pop
+  const uint32_t l0 = uint32_t(level);
+  const float frac = level - l0;
 
-  const float voxel_00 = linalg::lerp(voxel_000, voxel_001, fracLocal.x);
-  const float voxel_01 = linalg::lerp(voxel_010, voxel_011, fracLocal.x);
-  const float voxel_10 = linalg::lerp(voxel_100, voxel_101, fracLocal.x);
-  const float voxel_11 = linalg::lerp(voxel_110, voxel_111, fracLocal.x);
-  const float voxel_0 = linalg::lerp(voxel_00, voxel_01, fracLocal.y);
-  const float voxel_1 = linalg::lerp(voxel_10, voxel_11, fracLocal.y);
+  const float s0 = l0 == 0
+      ? sampleLocal(local)
+      : sampleLocal(m_levels[l0 - 1], local / float(1u << l0));
+  if (frac == 0.f || l0 + 1 >= numLevels)
+    return s0;
 
-  return linalg::lerp(voxel_0, voxel_1, fracLocal.z);
+  const float s1 = sampleLocal(m_levels[l0], local / float(1u << (l0 + 1)));
+  return linalg::lerp(s0, s1, frac);
 }
 
 box3 StructuredRegularField::bounds() const
@@ -90,10 +153,43 @@ float3 StructuredRegularField::objectToLocal(const float3 &object) const
   return 1.f / (m_spacing) * (object - m_origin);
 }
 
+bool StructuredRegularField::inBounds(const float3 &local) const
+{
+  return local.x >= 0.f && local.x <= m_dims.x - 1.f && local.y >= 0.f
+      && local.y <= m_dims.y - 1.f && local.z >= 0.f
+      && local.z <= m_dims.z - 1.f;
+}
+
+float StructuredRegularField::sampleLocal(const float3 &local) const
+{
+  const float3 clampedLocal =
+      linalg::clamp(local, float3(0.f), m_coordUpperBound);
+
+  const uint3 vi0 = uint3(clampedLocal);
+  const uint3 vi1 = linalg::clamp(vi0 + 1, uint3(0u), m_dims - 1);
+
+  return trilinear(vi0, vi1, clampedLocal - float3(vi0), [&](const uint3 &i) {
+    return valueAtVoxel(i);
+  });
+}
+
+float StructuredRegularField::sampleLocal(
+    const LODLevel &l, const float3 &local) const
+{
+  const float3 clampedLocal =
+      linalg::clamp(local, float3(0.f), l.coordUpperBound);
+
+  const uint3 vi0 = uint3(clampedLocal);
+  const uint3 vi1 = linalg::clamp(vi0 + 1, uint3(0u), l.dims - 1);
+
+  return trilinear(vi0, vi1, clampedLocal - float3(vi0), [&](const uint3 &i) {
+    return l.values[linearIndex(i, l.dims)];
+  });
+}
+
 float StructuredRegularField::valueAtVoxel(const uint3 &index) const
 {
-  const size_t i = size_t(index.x)
-      + m_dims.x * (size_t(index.y) + m_dims.y * size_t(index.z));
+  const size_t i = linearIndex(index, m_dims);
 
   switch (m_type) {
   case ANARI_FLOAT32:
@@ -114,4 +210,64 @@ float StructuredRegularField::valueAtVoxel(const uint3 &index) const
   return NAN;
 }
 
+void StructuredRegularField::buildLevelsOfDetail()
+{
+  std::vector<LODLevel> levels;
+
+  // Each level halves the previous one until it is at most 2 voxels wide;
+  // voxel 'i' of a level is a [1 2 1] tent filter of voxels 2i-1..2i+1 below
+  uint3 fineDims = m_dims;
+  while (linalg::maxelem(fineDims) > 2) {
+    const LODLevel *fine = levels.empty() ? nullptr : &levels.back();
+    auto fineValue = [&](const uint3 &i) {
+      return fine ? fine->values[linearIndex(i, fineDims)] : valueAtVoxel(i);
+    };
+
+    LODLevel l;
+    l.dims = fineDims / 2u + 1u;
+    l.dims = linalg::min(l.dims, fineDims);
+    l.coordUpperBound = float3(std::nextafter(l.dims.x - 1, 0),
+        std::nextafter(l.dims.y - 1, 0),
+        std::nextafter(l.dims.z - 1, 0));
+    l.values.resize(size_t(l.dims.x) * l.dims.y * l.dims.z);
+
+    embree::parallel_for(l.dims.z, [&](uint32_t z) {
+      for (uint32_t y = 0; y < l.dims.y; y++) {
+        for (uint32_t x = 0; x < l.dims.x; x++) {
+          const int3 center = int3(x, y, z) * 2;
+          float sum = 0.f;
+          float weightSum = 0.f;
+          for (int dz = -1; dz <= 1; dz++) {
+            for (int dy = -1; dy <= 1; dy++) {
+              for (int dx = -1; dx <= 1; dx++) {
+                const int3 i = center + int3(dx, dy, dz);
+                if (i.x < 0 || i.y < 0 || i.z < 0 || i.x >= int(fineDims.x)
+                    || i.y >= int(fineDims.y) || i.z >= int(fineDims.z))
+                  continue;
+                const float w = float((2 - std::abs(dx)) * (2 - std::abs(dy))
+                    * (2 - std::abs(dz)));
+                sum += w * fineValue(uint3(i));
+                weightSum += w;
+              }
+            }
+          }
+          l.values[linearIndex(uint3(x, y, z), l.dims)] = sum / weightSum;
+        }
+      }
+    });
+
+    fineDims = l.dims;
+    levels.push_back(std::move(l));
+  }
+
+  m_levels = std::move(levels);
+  m_numLevels.store(uint32_t(m_levels.size()) + 1, std::memory_order_release);
+}
+
+void StructuredRegularField::waitForLevelsOfDetail()
+{
+  if (m_levelBuild.valid())
+    m_levelBuild.get();
+}
+
 } // namespace helide
@@ -5,12 +5,17 @@
 
 #include "SpatialField.h"
 #include "array/Array3D.h"
+// std
+#include <atomic>
+#include <future>
+#include <vector>
 
 namespace helide {
 
 struct StructuredRegularField : public SpatialField
 {
   StructuredRegularField(HelideGlobalState *d);
+  ~StructuredRegularField() override;
 
   void commit() override;
 
@@ -18,12 +23,30 @@ struct StructuredRegularField : public SpatialField
 
   float sampleAt(const float3 &coord) const override;
 
+  float levelOfDetail(float width) const override;
+  float sampleAtLevel(const float3 &coord, float level) const override;
+
   box3 bounds() const override;
 
  private:
+  // A downsampled copy of the grid, level 'i' has voxels 2^i times as far apart
+  // as the original data
+  struct LODLevel
+  {
+    uint3 dims{0u};
+    float3 coordUpperBound;
+    std::vector<float> values;
+  };
+
   float3 objectToLocal(const float3 &object) const;
+  bool inBounds(const float3 &local) const;
+  float sampleLocal(const float3 &local) const;
+  float sampleLocal(const LODLevel &l, const float3 &local) const;
   float valueAtVoxel(const uint3 &index) const;
 
+  void buildLevelsOfDetail();
+  void waitForLevelsOfDetail();
+
   // Data //
 
   uint3 m_dims{0u};
@@ -36,6 +59,11 @@ struct StructuredRegularField : public SpatialField
 
   const void *m_data{nullptr};
   anari::DataType m_type{ANARI_UNKNOWN};
+
+  float m_lodBias{0.f};
+  std::vector<LODLevel> m_levels; // level 1 and up, level 0 is 'm_data'
+  std::atomic<uint32_t> m_numLevels{1}; // published once 'm_levels' is built
+  std::future<void> m_levelBuild;
 };
 
 } // namespace helide
@@ -3,12 +3,50 @@
 
 #include "BaseDevice.h"
 #include "BaseFrame.h"
-#include "array/Array.h"
+#include "array/Array1D.h"
+#include "array/Array2D.h"
+#include "array/Array3D.h"
 // anari
 #include "anari/backend/LibraryImpl.h"
 
 namespace helium {
 
+// Helper functions ///////////////////////////////////////////////////////////
+
+// Re-setting an object parameter to the same handle still needs a commit if
+// that object (or array data) changed since 'obj' was last committed
+static bool objectChangedSince(const BaseObject *obj, TimeStamp t)
+{
+  if (!obj)
+    return false;
+  else if (obj->lastUpdated() > t || obj->lastCommitted() > t)
+    return true;
+  auto *a = dynamic_cast<const Array *>(obj);
+  return a && a->lastDataModified() > t;
+}
+
+static bool arrayHasLayout(
+    const Array *a, ANARIDataType dataType, const uint64_t numElements[3])
+{
+  if (a->elementType() != dataType
+      || a->ownership() != ArrayDataOwnership::MANAGED || a->isMapped())
+    return false;
+
+  if (auto *a1 = dynamic_cast<const Array1D *>(a)) {
+    return a1->totalCapacity() == numElements[0]
+        && a1->size() == numElements[0];
+  } else if (auto *a2 = dynamic_cast<const Array2D *>(a)) {
+    return a2->size()
+        == uint2(uint32_t(numElements[0]), uint32_t(numElements[1]));
+  } else if (auto *a3 = dynamic_cast<const Array3D *>(a)) {
+    return a3->size()
+        == uint3(uint32_t(numElements[0]),
+            uint32_t(numElements[1]),
+            uint32_t(numElements[2]));
+  } else
+    return false;
+}
+
 // Data Arrays ////////////////////////////////////////////////////////////////
 
 void *BaseDevice::mapArray(ANARIArray a)
@@ -37,6 +75,12 @@ int BaseDevice::getProperty(ANARIObject object,
       m_state->commitBufferFlush();
     auto lock = getObjectLock(object);
     return referenceFromHandle(object).getProperty(name, type, mem, mask);
+  } else if (type == ANARI_UINT64
+      && std::string_view(name) == "pendingReclamations") {
+    if (mask == ANARI_WAIT)
+      m_state->waitForReclamation();
+    writeToVoidP(mem, uint64_t(m_state->numPendingReclamations()));
+    return 1;
   } else
     return deviceGetProperty(name, type, mem, mask);
 
@@ -54,12 +98,20 @@ void BaseDevice::setParameter(
     deviceSetParameter(name, type, mem);
     return;
   }
+  // Setting a parameter to the value it already has does not dirty the object,
+  // so redundant commits of unchanged objects are skipped when flushing
   auto &o = referenceFromHandle(object);
+  bool changed = false;
   if (anari::isObject(type) && mem == nullptr)
-    o.removeParam(name);
-  else
-    o.setParam(name, type, mem);
-  o.markUpdated();
+    changed = o.removeParam(name);
+  else {
+    changed = o.setParam(name, type, mem);
+    if (!changed && anari::isObject(type))
+      changed = objectChangedSince(*(BaseObject **)mem, o.lastCommitted());
+  }
+
+  if (changed)
+    o.markUpdated();
 }
 
 void BaseDevice::unsetParameter(ANARIObject o, const char *name)
@@ -70,8 +122,9 @@ void BaseDevice::unsetParameter(ANARIObject o, const char *name)
     deviceUnsetParameter(name);
   else {
     auto &obj = referenceFromHandle(o);
-    obj.removeParam(name);
-    obj.markUpdated();
+    obj.clearParameterArraySlots(name);
+    if (obj.removeParam(name))
+      obj.markUpdated();
   }
 }
 
@@ -83,8 +136,9 @@ void BaseDevice::unsetAllParameters(ANARIObject o)
     deviceUnsetAllParameters();
   else {
     auto &obj = referenceFromHandle(o);
-    obj.removeAllParams();
-    obj.markUpdated();
+    obj.clearParameterArraySlots();
+    if (obj.removeAllParams())
+      obj.markUpdated();
   }
 }
 
@@ -94,11 +148,9 @@ void *BaseDevice::mapParameterArray1D(ANARIObject o,
     uint64_t numElements1,
     uint64_t *elementStride)
 {
-  auto array = newArray1D(nullptr, nullptr, nullptr, dataType, numElements1);
-  setParameter(o, name, ANARI_ARRAY1D, &array);
+  const uint64_t numElements[3] = {numElements1, 1, 1};
   *elementStride = anari::sizeOf(dataType);
-  referenceFromHandle(array).refDec(RefType::PUBLIC);
-  return mapArray(array);
+  return mapParameterArray(o, name, ANARI_ARRAY1D, dataType, numElements);
 }
 
 void *BaseDevice::mapParameterArray2D(ANARIObject o,
@@ -108,12 +160,9 @@ void *BaseDevice::mapParameterArray2D(ANARIObject o,
     uint64_t numElements2,
     uint64_t *elementStride)
 {
-  auto array = newArray2D(
-      nullptr, nullptr, nullptr, dataType, numElements1, numElements2);
-  setParameter(o, name, ANARI_ARRAY2D, &array);
+  const uint64_t numElements[3] = {numElements1, numElements2, 1};
   *elementStride = anari::sizeOf(dataType);
-  referenceFromHandle(array).refDec(RefType::PUBLIC);
-  return mapArray(array);
+  return mapParameterArray(o, name, ANARI_ARRAY2D, dataType, numElements);
 }
 
 void *BaseDevice::mapParameterArray3D(ANARIObject o,
@@ -124,17 +173,9 @@ void *BaseDevice::mapParameterArray3D(ANARIObject o,
     uint64_t numElements3,
     uint64_t *elementStride)
 {
-  auto array = newArray3D(nullptr,
-      nullptr,
-      nullptr,
-      dataType,
-      numElements1,
-      numElements2,
-      numElements3);
-  setParameter(o, name, ANARI_ARRAY3D, &array);
+  const uint64_t numElements[3] = {numElements1, numElements2, numElements3};
   *elementStride = anari::sizeOf(dataType);
-  referenceFromHandle(array).refDec(RefType::PUBLIC);
-  return mapArray(array);
+  return mapParameterArray(o, name, ANARI_ARRAY3D, dataType, numElements);
 }
 
 void BaseDevice::unmapParameterArray(ANARIObject o, const char *name)
@@ -151,8 +192,14 @@ void BaseDevice::commitParameters(ANARIObject o)
   if (handleIsDevice(o)) {
     auto lock = scopeLockObject();
     deviceCommitParameters();
-  } else
-    m_state->commitBufferAddObject((BaseObject *)o);
+  } else {
+    auto &obj = referenceFromHandle(o);
+    {
+      auto lock = getObjectLock(o);
+      obj.pruneParameterArraySlots();
+    }
+    m_state->commitBufferAddObject(&obj);
+  }
 }
 
 void BaseDevice::release(ANARIObject o)
@@ -252,6 +299,7 @@ void BaseDevice::deviceCommitParameters()
       getParam<ANARIStatusCallback>("statusCallback", defaultStatusCallback());
   m_state->statusCBUserPtr = getParam<const void *>(
       "statusCallbackUserData", defaultStatusCallbackUserPtr());
+  m_state->deferredReclamation = getParam<bool>("deferredReclamation", false);
 }
 
 BaseDevice::~BaseDevice()
@@ -261,6 +309,9 @@ BaseDevice::~BaseDevice()
 
   auto &state = *m_state;
 
+  // Objects released right before the device may still be queued for deletion
+  state.waitForReclamation();
+
   auto reportLeaks = [&](auto &count, const char *handleType) {
     auto c = count.load();
     if (c != 0) {
@@ -314,6 +365,81 @@ void BaseDevice::deviceUnsetAllParameters()
   removeAllParams();
 }
 
+void *BaseDevice::mapParameterArray(ANARIObject o,
+    const char *name,
+    ANARIDataType arrayType,
+    ANARIDataType dataType,
+    const uint64_t numElements[3])
+{
+  if (handleIsDevice(o)) {
+    auto array = newParameterArray(arrayType, dataType, numElements);
+    setParameter(o, name, arrayType, &array);
+    referenceFromHandle(array).refDec(RefType::PUBLIC);
+    return mapArray(array);
+  }
+
+  auto &obj = referenceFromHandle(o);
+
+  // Reuse an array from a previous map of this parameter if nothing but the
+  // slot still references it: the parameter has moved on to another array and
+  // every object which committed with it has since been recommitted. With two
+  // slots per parameter, per-frame updates alternate between them.
+  ANARIArray array = nullptr;
+  BaseArray **slot = nullptr;
+  {
+    auto lock = getObjectLock(o);
+    auto *current = obj.getParamObject<BaseArray>(name);
+    for (auto &s : obj.parameterArraySlots(name)) {
+      if (s && s->useCount() == 1 && s->type() == arrayType
+          && arrayHasLayout((Array *)s, dataType, numElements)) {
+        array = (ANARIArray)s;
+        break;
+      } else if (!slot && (!s || s != current)) {
+        slot = &s;
+      }
+    }
+  }
+
+  if (array) {
+    // Mapped parameter array contents are undefined until the app writes
+    // them, so neither copy nor clear what this array held before
+    setParameter(o, name, arrayType, &array);
+    referenceFromHandle<Array>(array).discardContentsOnNextMap();
+    return mapArray(array);
+  }
+
+  array = newParameterArray(arrayType, dataType, numElements);
+  if (slot)
+    obj.setParameterArraySlot(*slot, &referenceFromHandle<BaseArray>(array));
+  setParameter(o, name, arrayType, &array);
+  referenceFromHandle(array).refDec(RefType::PUBLIC);
+  return mapArray(array);
+}
+
+ANARIArray BaseDevice::newParameterArray(ANARIDataType arrayType,
+    ANARIDataType dataType,
+    const uint64_t numElements[3])
+{
+  if (arrayType == ANARI_ARRAY1D)
+    return newArray1D(nullptr, nullptr, nullptr, dataType, numElements[0]);
+  else if (arrayType == ANARI_ARRAY2D) {
+    return newArray2D(nullptr,
+        nullptr,
+        nullptr,
+        dataType,
+        numElements[0],
+        numElements[1]);
+  } else {
+    return newArray3D(nullptr,
+        nullptr,
+        nullptr,
+        dataType,
+        numElements[0],
+        numElements[1],
+        numElements[2]);
+  }
+}
+
 std::scoped_lock<std::mutex> BaseDevice::getObjectLock(ANARIObject object)
 {
   if (handleIsDevice(object))
@@ -101,6 +101,15 @@ struct BaseDevice : public anari::DeviceImpl,
  private:
   std::scoped_lock<std::mutex> getObjectLock(ANARIObject object);
 
+  void *mapParameterArray(ANARIObject o,
+      const char *name,
+      ANARIDataType arrayType,
+      ANARIDataType dataType,
+      const uint64_t numElements[3]);
+  ANARIArray newParameterArray(ANARIDataType arrayType,
+      ANARIDataType dataType,
+      const uint64_t numElements[3]);
+
   void deviceGetProperty(const char *id, ANARIDataType type, const void *mem);
   void deviceSetParameter(const char *id, ANARIDataType type, const void *mem);
   void deviceUnsetParameter(const char *id);
@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "BaseGlobalDeviceState.h"
+#include "BaseObject.h"
+// std
+#include <algorithm>
 
 namespace helium {
 
@@ -32,7 +35,19 @@ void BaseGlobalDeviceState::commitBufferAddObject(BaseObject *o)
 void BaseGlobalDeviceState::commitBufferFlush()
 {
   std::lock_guard<std::mutex> guard(m_mutex);
-  m_commitBuffer.flush();
+  if (m_commitBuffer.flush())
+    epochs.advance();
+}
+
+void BaseGlobalDeviceState::commitBufferFlush(
+    const std::vector<ANARIDataType> &types)
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+  auto ofType = [&](const BaseObject *o) {
+    return std::find(types.begin(), types.end(), o->type()) != types.end();
+  };
+  if (m_commitBuffer.flush(ofType))
+    epochs.advance();
 }
 
 void BaseGlobalDeviceState::commitBufferClear()
@@ -47,4 +62,28 @@ TimeStamp BaseGlobalDeviceState::commitBufferLastFlush() const
   return m_commitBuffer.lastFlush();
 }
 
+bool BaseGlobalDeviceState::commitBufferContains(
+    const std::vector<ANARIDataType> &types) const
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+  return m_commitBuffer.contains([&](const BaseObject *o) {
+    return std::find(types.begin(), types.end(), o->type()) != types.end();
+  });
+}
+
+void BaseGlobalDeviceState::reclaimObject(const RefCounted *o)
+{
+  m_reclamationQueue.reclaim(o);
+}
+
+void BaseGlobalDeviceState::waitForReclamation()
+{
+  m_reclamationQueue.wait();
+}
+
+size_t BaseGlobalDeviceState::numPendingReclamations() const
+{
+  return m_reclamationQueue.size();
+}
+
 } // namespace helium
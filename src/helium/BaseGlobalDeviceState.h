@@ -4,6 +4,8 @@
 #pragma once
 
 #include "utility/DeferredCommitBuffer.h"
+#include "utility/DeferredReclamationQueue.h"
+#include "utility/EpochTracker.h"
 // anari
 #include <anari/anari_cpp/ext/linalg.h>
 #include <anari/anari_cpp.hpp>
@@ -12,6 +14,7 @@
 #include <functional>
 #include <mutex>
 #include <string>
+#include <vector>
 
 namespace helium {
 
@@ -22,8 +25,19 @@ struct BaseGlobalDeviceState
 {
   void commitBufferAddObject(BaseObject *o);
   void commitBufferFlush();
+  // Only commit objects of the given types, leaving the rest buffered
+  void commitBufferFlush(const std::vector<ANARIDataType> &types);
   void commitBufferClear();
   TimeStamp commitBufferLastFlush() const;
+  // Return if an object of one of the given types is waiting to be committed
+  bool commitBufferContains(const std::vector<ANARIDataType> &types) const;
+
+  // With 'deferredReclamation' set, objects whose last reference was released
+  // are deleted on a background thread, these let devices wait for that to
+  // finish (e.g. before teardown)
+  void reclaimObject(const RefCounted *o);
+  void waitForReclamation();
+  size_t numPendingReclamations() const;
 
   // Data //
 
@@ -32,12 +46,22 @@ struct BaseGlobalDeviceState
 
   std::function<void(int, const std::string &, const void *)> messageFunction;
 
+  // Each commit buffer flush starts a new epoch of committed scene state
+  EpochTracker epochs;
+
+  // Opt-in through the 'deferredReclamation' device parameter. Destructors
+  // (and app memory deleters) then run on the reclamation thread, so only
+  // devices whose objects tolerate that should enable it.
+  std::atomic<bool> deferredReclamation{false};
+
   BaseGlobalDeviceState(ANARIDevice d);
   virtual ~BaseGlobalDeviceState() = default;
 
  private:
   DeferredCommitBuffer m_commitBuffer;
+  DeferredReclamationQueue m_reclamationQueue;
   mutable std::mutex m_mutex;
+  std::mutex m_observerMutex; // guards the observer lists of this device
 
   friend struct BaseObject;
   friend struct BaseDevice;
@@ -2,8 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "BaseObject.h"
+#include "array/Array.h"
 // std
+#include <algorithm>
 #include <cstdarg>
+#include <mutex>
 
 namespace helium {
 
@@ -55,6 +58,17 @@ BaseObject::BaseObject(ANARIDataType type, BaseGlobalDeviceState *state)
 
 BaseObject::~BaseObject()
 {
+  detachFromObservedObjects();
+  {
+    auto lock = lockObservers();
+    for (auto *o : m_observers) {
+      auto &v = o->m_observing;
+      v.erase(std::remove(v.begin(), v.end(), this), v.end());
+    }
+    m_observers.clear();
+  }
+
+  clearParameterArraySlots();
   decrementObjectCount();
 }
 
@@ -90,19 +104,27 @@ void BaseObject::markCommitted()
 
 void BaseObject::addCommitObserver(BaseObject *obj)
 {
+  auto lock = lockObservers();
   m_observers.push_back(obj);
+  obj->m_observing.push_back(this);
 }
 
 void BaseObject::removeCommitObserver(BaseObject *obj)
 {
+  auto lock = lockObservers();
   m_observers.erase(std::remove_if(m_observers.begin(),
                         m_observers.end(),
                         [&](BaseObject *o) -> bool { return o == obj; }),
       m_observers.end());
+  auto &v = obj->m_observing;
+  auto found = std::find(v.begin(), v.end(), this);
+  if (found != v.end())
+    v.erase(found);
 }
 
 void BaseObject::notifyCommitObservers() const
 {
+  auto lock = lockObservers();
   for (auto o : m_observers)
     notifyObserver(o);
 }
@@ -112,11 +134,96 @@ BaseGlobalDeviceState *BaseObject::deviceState() const
   return m_state;
 }
 
+BaseObject::ParameterArraySlots &BaseObject::parameterArraySlots(
+    const std::string &name)
+{
+  return m_parameterArraySlots[name];
+}
+
+void BaseObject::setParameterArraySlot(BaseArray *&slot, BaseArray *array)
+{
+  if (array)
+    array->refInc(RefType::INTERNAL);
+  if (slot)
+    slot->refDec(RefType::INTERNAL);
+  slot = array;
+}
+
+void BaseObject::queueObserverCommit(BaseObject *obj) const
+{
+  obj->markUpdated();
+  if (m_state)
+    m_state->m_commitBuffer.addObject(obj);
+}
+
+void BaseObject::clearParameterArraySlots(const std::string &name)
+{
+  auto found = m_parameterArraySlots.find(name);
+  if (found == m_parameterArraySlots.end())
+    return;
+  for (auto *&a : found->second)
+    setParameterArraySlot(a, nullptr);
+  m_parameterArraySlots.erase(found);
+}
+
+void BaseObject::clearParameterArraySlots()
+{
+  for (auto &s : m_parameterArraySlots) {
+    for (auto *&a : s.second)
+      setParameterArraySlot(a, nullptr);
+  }
+  m_parameterArraySlots.clear();
+}
+
+void BaseObject::pruneParameterArraySlots()
+{
+  for (auto s = m_parameterArraySlots.begin();
+       s != m_parameterArraySlots.end();) {
+    auto *current = getParamObject<BaseArray>(s->first);
+    const auto &slots = s->second;
+    const auto found = std::find(slots.begin(), slots.end(), current);
+    if (current && found != slots.end())
+      ++s;
+    else {
+      for (auto *&a : s->second)
+        setParameterArraySlot(a, nullptr);
+      s = m_parameterArraySlots.erase(s);
+    }
+  }
+}
+
 void BaseObject::notifyObserver(BaseObject *obj) const
 {
   // no-op
 }
 
+void BaseObject::onLastReferenceReleased() const
+{
+  if (!m_state || !m_state->deferredReclamation) {
+    delete this;
+    return;
+  }
+
+  const_cast<BaseObject *>(this)->detachFromObservedObjects();
+  m_state->reclaimObject(this);
+}
+
+std::unique_lock<std::mutex> BaseObject::lockObservers() const
+{
+  return m_state ? std::unique_lock<std::mutex>(m_state->m_observerMutex)
+                 : std::unique_lock<std::mutex>();
+}
+
+void BaseObject::detachFromObservedObjects()
+{
+  auto lock = lockObservers();
+  for (auto *o : m_observing) {
+    auto &v = o->m_observers;
+    v.erase(std::remove(v.begin(), v.end(), this), v.end());
+  }
+  m_observing.clear();
+}
+
 void BaseObject::incrementObjectCount()
 {
   auto *s = deviceState();
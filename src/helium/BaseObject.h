@@ -8,6 +8,8 @@
 // anari_cpp
 #include <anari/anari_cpp.hpp>
 // std
+#include <array>
+#include <map>
 #include <string_view>
 
 #include "BaseGlobalDeviceState.h"
@@ -16,6 +18,8 @@
 
 namespace helium {
 
+struct BaseArray;
+
 struct BaseObject : public RefCounted, ParameterizedObject, LockableObject
 {
   // Construct
@@ -63,18 +67,44 @@ struct BaseObject : public RefCounted, ParameterizedObject, LockableObject
 
   BaseGlobalDeviceState *deviceState() const;
 
+  // Arrays previously created by anariMapParameterArray*() for a parameter on
+  // this object. Each entry holds an internal reference so BaseDevice can map
+  // it again once nothing else uses it, instead of allocating a new array.
+  using ParameterArraySlots = std::array<BaseArray *, 2>;
+  ParameterArraySlots &parameterArraySlots(const std::string &name);
+  void setParameterArraySlot(BaseArray *&slot, BaseArray *array);
+  // Release the slots of one (or, without a name, every) parameter
+  void clearParameterArraySlots(const std::string &name);
+  void clearParameterArraySlots();
+  // Release the slots of parameters now set to some other array (or value)
+  void pruneParameterArraySlots();
+
  protected:
   // Handle what happens when the observing object 'obj' is being notified of
   // that this object has changed.
   virtual void notifyObserver(BaseObject *obj) const;
 
+  // Mark 'obj' as updated and queue it for commit, for notifyObserver()
+  // overrides. The commit buffer is not locked, so this is safe to call from
+  // within commit() or markCommitted() while the buffer is being flushed.
+  void queueObserverCommit(BaseObject *obj) const;
+
+  // Deleted right away unless the device defers reclamation, in which case
+  // the object detaches from observed objects so nothing can reach it through
+  // them anymore and is handed to the device for background deletion
+  void onLastReferenceReleased() const override;
+
   BaseGlobalDeviceState *m_state{nullptr};
 
  private:
   void incrementObjectCount();
   void decrementObjectCount();
+  void detachFromObservedObjects();
+  std::unique_lock<std::mutex> lockObservers() const;
 
   std::vector<BaseObject *> m_observers;
+  std::vector<BaseObject *> m_observing;
+  std::map<std::string, ParameterArraySlots> m_parameterArraySlots;
   TimeStamp m_lastUpdated{0};
   TimeStamp m_lastCommitted{0};
   ANARIDataType m_type{ANARI_OBJECT};
@@ -97,7 +97,13 @@ void *Array::map()
     reportMessage(ANARI_SEVERITY_WARNING,
         "array mapped again without being previously unmapped");
   }
+  // Nothing reads the current data while mapped directly, so a pending new
+  // version can be swapped in right away
+  std::lock_guard<std::mutex> lock(m_stagedMutex);
+  if (m_hostData.staged.mem)
+    adoptStagedData();
   m_mapped = true;
+  m_discardContentsOnMap = false;
   return const_cast<void *>(data());
 }
 
@@ -108,7 +114,20 @@ void Array::unmap()
         "array unmapped again without being previously mapped");
     return;
   }
-  m_mapped = false;
+  bool mappedNewVersion = false;
+  {
+    std::lock_guard<std::mutex> lock(m_stagedMutex);
+    m_mapped = false;
+    std::swap(mappedNewVersion, m_mappedNewVersion);
+  }
+
+  if (mappedNewVersion) {
+    // Published when the commit buffer is next flushed, see markCommitted()
+    markUpdated();
+    deviceState()->commitBufferAddObject(this);
+    return;
+  }
+
   markDataModified();
   notifyCommitObservers();
 }
@@ -118,6 +137,69 @@ bool Array::isMapped() const
   return m_mapped;
 }
 
+bool Array::supportsVersionedMap() const
+{
+  return ownership() == ArrayDataOwnership::MANAGED
+      && !anari::isObject(elementType());
+}
+
+void *Array::mapNewVersion()
+{
+  if (!supportsVersionedMap())
+    return map();
+
+  if (isMapped()) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "array mapped again without being previously unmapped");
+  }
+
+  std::lock_guard<std::mutex> lock(m_stagedMutex);
+
+  // Repeated maps before the next flush keep writing the same new version
+  if (!m_hostData.staged.mem) {
+    auto totalBytes = totalCapacity() * anari::sizeOf(elementType());
+    m_hostData.staged.mem = malloc(totalBytes);
+    if (!m_discardContentsOnMap)
+      std::memcpy(m_hostData.staged.mem, m_hostData.managed.mem, totalBytes);
+  }
+
+  m_mapped = true;
+  m_discardContentsOnMap = false;
+  m_mappedNewVersion = true;
+  return m_hostData.staged.mem;
+}
+
+bool Array::isMappedAsNewVersion() const
+{
+  std::lock_guard<std::mutex> lock(m_stagedMutex);
+  return m_mapped && m_mappedNewVersion;
+}
+
+void Array::discardContentsOnNextMap()
+{
+  std::lock_guard<std::mutex> lock(m_stagedMutex);
+  m_discardContentsOnMap = true;
+}
+
+void Array::markCommitted()
+{
+  bool published = false;
+  {
+    std::lock_guard<std::mutex> lock(m_stagedMutex);
+    if (m_hostData.staged.mem && !m_mapped) {
+      adoptStagedData();
+      published = true;
+    }
+  }
+
+  if (published) {
+    markDataModified();
+    notifyCommitObservers();
+  }
+
+  BaseArray::markCommitted();
+}
+
 bool Array::wasPrivatized() const
 {
   return m_privatized;
@@ -128,6 +210,11 @@ void Array::markDataModified()
   m_lastDataModified = helium::newTimeStamp();
 }
 
+helium::TimeStamp Array::lastDataModified() const
+{
+  return m_lastDataModified;
+}
+
 bool Array::isOffloaded() const
 {
   return m_isOffloaded;
@@ -198,7 +285,9 @@ void Array::freeAppMemory()
   } else if (ownership() == ArrayDataOwnership::MANAGED) {
     reportMessage(ANARI_SEVERITY_DEBUG, "freeing managed array");
     free(m_hostData.managed.mem);
+    free(m_hostData.staged.mem);
     zeroOutStruct(m_hostData.managed);
+    m_hostData.staged = {};
   } else if (wasPrivatized()) {
     free(m_hostData.privatized.mem);
     zeroOutStruct(m_hostData.privatized);
@@ -217,6 +306,14 @@ void Array::initManagedMemory()
   }
 }
 
+void Array::adoptStagedData()
+{
+  void *previous = m_hostData.managed.mem;
+  m_hostData.managed.mem = m_hostData.staged.mem;
+  m_hostData.staged = {};
+  deviceState()->epochs.retire([previous]() { free(previous); });
+}
+
 void Array::notifyObserver(BaseObject *o) const
 {
   o->markUpdated();
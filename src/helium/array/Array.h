@@ -6,6 +6,7 @@
 #include "../BaseObject.h"
 #include "../helium_math.h"
 // std
+#include <mutex>
 #include <sstream>
 
 namespace helium {
@@ -72,9 +73,24 @@ struct Array : public BaseArray
 
   bool isMapped() const;
 
+  // Managed arrays can be mapped into a new copy of their data while the
+  // current data is still being read (e.g. by frames in flight). The new
+  // version replaces the current one when the array is next committed by a
+  // commit buffer flush, and the old one is retired through the device's
+  // epochs.
+  bool supportsVersionedMap() const;
+  void *mapNewVersion();
+  bool isMappedAsNewVersion() const;
+  // The next map leaves the array's contents undefined instead of carrying
+  // them over, so a new version is not copied from the current one
+  void discardContentsOnNextMap();
+
+  void markCommitted() override;
+
   bool wasPrivatized() const;
 
   void markDataModified();
+  helium::TimeStamp lastDataModified() const;
 
   bool isOffloaded() const;
   void markDataIsOffloaded(bool isOffloaded = true);
@@ -93,6 +109,7 @@ struct Array : public BaseArray
   void makePrivatizedCopy(size_t numElements);
   void freeAppMemory();
   void initManagedMemory();
+  void adoptStagedData();
 
   void notifyObserver(BaseObject *) const override;
 
@@ -122,11 +139,21 @@ struct Array : public BaseArray
     {
       void *mem{nullptr};
     } privatized;
+
+    struct StagedData
+    {
+      void *mem{nullptr};
+    } staged;
   } m_hostData;
 
   helium::TimeStamp m_lastDataModified{0};
   mutable helium::TimeStamp m_lastDataUploaded{0};
   bool m_mapped{false};
+  bool m_mappedNewVersion{false};
+  bool m_discardContentsOnMap{false};
+  // Guards staged data, which the commit buffer flush may publish while the
+  // application maps the array from another thread
+  mutable std::mutex m_stagedMutex;
 
  private:
   ArrayDataOwnership m_ownership{ArrayDataOwnership::INVALID};
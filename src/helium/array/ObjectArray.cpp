@@ -26,6 +26,7 @@ ObjectArray::ObjectArray(
     : Array(ANARI_ARRAY1D, state, d), m_capacity(d.numItems), m_end(d.numItems)
 {
   m_appHandles.resize(d.numItems, nullptr);
+  m_liveHandles.resize(d.numItems, nullptr);
   initManagedMemory();
   updateInternalHandleArrays();
 }
@@ -49,6 +50,9 @@ void ObjectArray::commit()
 
   if (size() == 0) {
     reportMessage(ANARI_SEVERITY_ERROR, "array size must be greater than zero");
+    // Keep the range the live handles were last built for
+    m_begin = oldBegin;
+    m_end = oldEnd;
     return;
   }
 
@@ -59,6 +63,7 @@ void ObjectArray::commit()
   }
 
   if (m_begin != oldBegin || m_end != oldEnd) {
+    rebuildLiveHandles();
     markDataModified();
     notifyCommitObservers();
   }
@@ -98,7 +103,7 @@ void ObjectArray::unmap()
 
 BaseObject **ObjectArray::handlesBegin() const
 {
-  return m_liveHandles.data() + m_begin;
+  return m_liveHandles.data();
 }
 
 BaseObject **ObjectArray::handlesEnd() const
@@ -110,7 +115,7 @@ void ObjectArray::appendHandle(BaseObject *o)
 {
   o->refInc(helium::RefType::INTERNAL);
   m_appendedHandles.push_back(o);
-  updateInternalHandleArrays();
+  m_liveHandles.push_back(o);
 }
 
 void ObjectArray::removeAppendedHandles()
@@ -123,20 +128,30 @@ void ObjectArray::removeAppendedHandles()
 
 void ObjectArray::updateInternalHandleArrays() const
 {
-  m_liveHandles.resize(totalSize());
+  if (!data())
+    return;
 
-  if (data()) {
-    auto **srcAllBegin = (BaseObject **)data();
-    auto **srcAllEnd = srcAllBegin + totalCapacity();
-    std::for_each(srcAllBegin, srcAllEnd, refIncObject);
-    std::for_each(m_appHandles.begin(), m_appHandles.end(), refDecObject);
-    std::copy(srcAllBegin, srcAllEnd, m_appHandles.data());
-
-    auto **srcRegionBegin = srcAllBegin + m_begin;
-    auto **srcRegionEnd = srcRegionBegin + size();
-    std::copy(srcRegionBegin, srcRegionEnd, m_liveHandles.data());
+  // Only slots whose handle changed since the last update touch ref counts
+  auto **src = (BaseObject **)data();
+  for (size_t i = 0; i < m_appHandles.size(); i++) {
+    auto *newHandle = src[i];
+    auto *&oldHandle = m_appHandles[i];
+    if (newHandle == oldHandle)
+      continue;
+    refIncObject(newHandle);
+    refDecObject(oldHandle);
+    oldHandle = newHandle;
+    if (i >= m_begin && i < m_end)
+      m_liveHandles[i - m_begin] = newHandle;
   }
+}
 
+void ObjectArray::rebuildLiveHandles() const
+{
+  m_liveHandles.resize(totalSize());
+  std::copy(m_appHandles.begin() + m_begin,
+      m_appHandles.begin() + m_end,
+      m_liveHandles.begin());
   std::copy(m_appendedHandles.begin(),
       m_appendedHandles.end(),
       m_liveHandles.begin() + size());
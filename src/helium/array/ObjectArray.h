@@ -30,9 +30,12 @@ struct ObjectArray : public Array
 
  private:
   void updateInternalHandleArrays() const;
+  void rebuildLiveHandles() const;
 
   mutable std::vector<BaseObject *> m_appendedHandles;
+  // Last seen contents of the whole app array, each holding an internal ref
   mutable std::vector<BaseObject *> m_appHandles;
+  // Handles in [begin, end) followed by the appended handles
   mutable std::vector<BaseObject *> m_liveHandles;
   size_t m_capacity{0};
   size_t m_begin{0};
@@ -27,6 +27,12 @@ void DeferredCommitBuffer::addObject(BaseObject *obj)
 }
 
 bool DeferredCommitBuffer::flush()
+{
+  return flush([](const BaseObject *) { return true; });
+}
+
+bool DeferredCommitBuffer::flush(
+    const std::function<bool(const BaseObject *)> &filter)
 {
   if (m_commitBuffer.empty())
     return false;
@@ -41,22 +47,40 @@ bool DeferredCommitBuffer::flush()
 
   m_needToSortCommits = false;
 
+  bool committedAny = false;
+  std::vector<BaseObject *> deferred;
   size_t i = 0;
   size_t end = m_commitBuffer.size();
   while (i != end) {
     for (;i < end; i++) {
       auto obj = m_commitBuffer[i];
+      if (!filter(obj)) {
+        deferred.push_back(obj);
+        m_commitBuffer[i] = nullptr;
+        continue;
+      }
       if (obj->useCount() > 1 && obj->lastUpdated() > obj->lastCommitted()) {
         obj->commit();
         obj->markCommitted();
+        committedAny = true;
       }
     }
     end = m_commitBuffer.size();
   }
 
-  clear();
-  m_lastFlush = newTimeStamp();
-  return true;
+  releaseObjects();
+
+  // Deferred objects keep the reference taken when they were added
+  if (!deferred.empty()) {
+    m_commitBuffer = std::move(deferred);
+    m_needToSortCommits = true;
+  }
+
+  // Objects committed without changes leave the last flush time untouched,
+  // so frames see nothing new to render
+  if (committedAny)
+    m_lastFlush = newTimeStamp();
+  return committedAny;
 }
 
 TimeStamp DeferredCommitBuffer::lastFlush() const
@@ -66,15 +90,28 @@ TimeStamp DeferredCommitBuffer::lastFlush() const
 
 void DeferredCommitBuffer::clear()
 {
-  for (auto &obj : m_commitBuffer)
-    obj->refDec(RefType::INTERNAL);
-  m_commitBuffer.clear();
+  releaseObjects();
   m_lastFlush = 0;
 }
 
+void DeferredCommitBuffer::releaseObjects()
+{
+  for (auto &obj : m_commitBuffer) {
+    if (obj)
+      obj->refDec(RefType::INTERNAL);
+  }
+  m_commitBuffer.clear();
+}
+
 bool DeferredCommitBuffer::empty() const
 {
   return m_commitBuffer.empty();
 }
 
+bool DeferredCommitBuffer::contains(
+    const std::function<bool(const BaseObject *)> &filter) const
+{
+  return std::any_of(m_commitBuffer.begin(), m_commitBuffer.end(), filter);
+}
+
 } // namespace helium
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include "TimeStamp.h"
 // std
+#include <functional>
 #include <vector>
 
 namespace helium {
@@ -21,9 +22,14 @@ struct DeferredCommitBuffer
   void addObject(BaseObject *obj);
 
   // Sort objects by priority and call BaseObject::commit() on each object
+  // updated since it was last committed, returns if any object was committed
   bool flush();
 
-  // Return when this buffer was last flushed
+  // Like flush(), but only objects accepted by 'filter' are committed, all
+  // others stay in the buffer for a later flush
+  bool flush(const std::function<bool(const BaseObject *)> &filter);
+
+  // Return when this buffer was last flushed with an object being committed
   TimeStamp lastFlush() const;
 
   // Clear the buffer without committing any of them
@@ -32,7 +38,12 @@ struct DeferredCommitBuffer
   // Return if the buffer is empty or not
   bool empty() const;
 
+  // Return if any buffered object is accepted by 'filter'
+  bool contains(const std::function<bool(const BaseObject *)> &filter) const;
+
  private:
+  void releaseObjects();
+
   std::vector<BaseObject *> m_commitBuffer;
   bool m_needToSortCommits{false};
   TimeStamp m_lastFlush{0};
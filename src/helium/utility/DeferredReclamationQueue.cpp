@@ -0,0 +1,71 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "DeferredReclamationQueue.h"
+#include "IntrusivePtr.h"
+
+namespace helium {
+
+DeferredReclamationQueue::~DeferredReclamationQueue()
+{
+  wait();
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_workAvailable.notify_all();
+
+  if (m_thread.joinable())
+    m_thread.join();
+}
+
+void DeferredReclamationQueue::reclaim(const RefCounted *obj)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queue.push_back(obj);
+    if (!m_thread.joinable())
+      m_thread = std::thread([&]() { run(); });
+  }
+  m_workAvailable.notify_one();
+}
+
+void DeferredReclamationQueue::wait()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  if (m_thread.joinable() && std::this_thread::get_id() == m_thread.get_id())
+    return; // called from a destructor being run by this queue
+  m_drained.wait(lock, [&]() { return m_queue.empty() && m_numInFlight == 0; });
+}
+
+size_t DeferredReclamationQueue::size() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_queue.size() + m_numInFlight;
+}
+
+void DeferredReclamationQueue::run()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true) {
+    m_workAvailable.wait(lock, [&]() { return m_stop || !m_queue.empty(); });
+    if (m_queue.empty() && m_stop)
+      return;
+
+    // Delete in release order; destructors may reclaim more objects, which
+    // are appended and handled before the queue is reported as drained.
+    const RefCounted *obj = m_queue.front();
+    m_queue.pop_front();
+    m_numInFlight++;
+    lock.unlock();
+    delete obj;
+    lock.lock();
+    m_numInFlight--;
+
+    if (m_queue.empty() && m_numInFlight == 0)
+      m_drained.notify_all();
+  }
+}
+
+} // namespace helium
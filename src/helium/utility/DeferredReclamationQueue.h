@@ -0,0 +1,45 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// std
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace helium {
+
+class RefCounted;
+
+struct DeferredReclamationQueue
+{
+  DeferredReclamationQueue() = default;
+  ~DeferredReclamationQueue();
+
+  // Hand over an object which no longer has any references. It is deleted on
+  // a background thread so large frees and teardown of backend resources do
+  // not stall the thread which dropped the last reference.
+  void reclaim(const RefCounted *obj);
+
+  // Block until every object reclaimed so far (and anything their destructors
+  // released in turn) has been deleted
+  void wait();
+
+  // Number of objects queued or currently being deleted
+  size_t size() const;
+
+ private:
+  void run();
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_workAvailable;
+  std::condition_variable m_drained;
+  std::deque<const RefCounted *> m_queue;
+  size_t m_numInFlight{0};
+  bool m_stop{false};
+  std::thread m_thread;
+};
+
+} // namespace helium
@@ -0,0 +1,103 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "EpochTracker.h"
+
+namespace helium {
+
+EpochTracker::~EpochTracker()
+{
+  for (auto &r : m_retired)
+    r.second();
+}
+
+Epoch EpochTracker::current() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_current;
+}
+
+Epoch EpochTracker::advance()
+{
+  std::deque<std::function<void()>> releasable;
+  Epoch e = 0;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    e = ++m_current;
+    releasable = collectReleasable();
+  }
+  for (auto &r : releasable)
+    r();
+  return e;
+}
+
+Epoch EpochTracker::pin()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_pins[m_current]++;
+  return m_current;
+}
+
+void EpochTracker::unpin(Epoch e)
+{
+  std::deque<std::function<void()>> releasable;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = m_pins.find(e);
+    if (found == m_pins.end())
+      return;
+    if (--found->second == 0)
+      m_pins.erase(found);
+    releasable = collectReleasable();
+  }
+  for (auto &r : releasable)
+    r();
+}
+
+size_t EpochTracker::numPinned() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  size_t n = 0;
+  for (auto &p : m_pins)
+    n += p.second;
+  return n;
+}
+
+void EpochTracker::retire(std::function<void()> release)
+{
+  std::deque<std::function<void()>> releasable;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_retired.emplace_back(m_current, std::move(release));
+    releasable = collectReleasable();
+  }
+  for (auto &r : releasable)
+    r();
+}
+
+size_t EpochTracker::numRetired() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_retired.size();
+}
+
+std::deque<std::function<void()>> EpochTracker::collectReleasable()
+{
+  // Retired entries are in epoch order, so stop at the first one which is
+  // still visible to the oldest pinned reader
+  const bool anyPinned = !m_pins.empty();
+  const Epoch oldestPinned = anyPinned ? m_pins.begin()->first : 0;
+
+  std::deque<std::function<void()>> releasable;
+  while (!m_retired.empty()) {
+    auto &r = m_retired.front();
+    if (anyPinned && r.first >= oldestPinned)
+      break;
+    releasable.push_back(std::move(r.second));
+    m_retired.pop_front();
+  }
+
+  return releasable;
+}
+
+} // namespace helium
@@ -0,0 +1,55 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// std
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+
+namespace helium {
+
+using Epoch = uint64_t;
+
+// Tracks which versions of committed scene state are still being read. Each
+// commit buffer flush starts a new epoch, readers (e.g. frames) pin the epoch
+// they started with, and data replaced by a newer version is only released
+// once no reader pinned to an epoch it was visible in remains.
+struct EpochTracker
+{
+  EpochTracker() = default;
+  ~EpochTracker();
+
+  // Epoch of the most recently committed scene state
+  Epoch current() const;
+
+  // Start a new epoch, returning its value
+  Epoch advance();
+
+  // Mark the current epoch as being read until the matching unpin()
+  Epoch pin();
+  void unpin(Epoch e);
+
+  // Number of readers holding a pin on any epoch
+  size_t numPinned() const;
+
+  // Release data which was visible up to the current epoch as soon as no
+  // reader can still see it (possibly right away)
+  void retire(std::function<void()> release);
+
+  // Number of retired releases still waiting on pinned readers
+  size_t numRetired() const;
+
+ private:
+  std::deque<std::function<void()>> collectReleasable();
+
+  mutable std::mutex m_mutex;
+  Epoch m_current{0};
+  std::map<Epoch, size_t> m_pins;
+  std::deque<std::pair<Epoch, std::function<void()>>> m_retired;
+};
+
+} // namespace helium
@@ -32,6 +32,10 @@ class RefCounted
   void refDec(RefType = PUBLIC) const;
   uint32_t useCount(RefType = ALL) const;
 
+ protected:
+  // Called once the last reference is released, deletes the object by default
+  virtual void onLastReferenceReleased() const;
+
  private:
   mutable std::atomic<uint32_t> m_internalRefs{0};
   mutable std::atomic<uint32_t> m_publicRefs{1};
@@ -59,7 +63,12 @@ inline void RefCounted::refDec(RefType type) const
     m_internalRefs--;
 
   if (useCount(RefType::ALL) == 0)
-    delete this;
+    onLastReferenceReleased();
+}
+
+inline void RefCounted::onLastReferenceReleased() const
+{
+  delete this;
 }
 
 inline uint32_t RefCounted::useCount(RefType type) const
@@ -12,10 +12,15 @@ bool ParameterizedObject::hasParam(const std::string &name)
   return findParam(name, false) != nullptr;
 }
 
-void ParameterizedObject::setParam(
+bool ParameterizedObject::setParam(
     const std::string &name, ANARIDataType type, const void *v)
 {
-  findParam(name, true)->second = AnariAny(type, v);
+  AnariAny value(type, v);
+  auto &current = findParam(name, true)->second;
+  if (current == value)
+    return false;
+  current = std::move(value);
+  return true;
 }
 
 bool ParameterizedObject::getParam(
@@ -51,19 +56,24 @@ void ParameterizedObject::setParamDirect(
   findParam(name, true)->second = v;
 }
 
-void ParameterizedObject::removeParam(const std::string &name)
+bool ParameterizedObject::removeParam(const std::string &name)
 {
   auto foundParam = std::find_if(m_params.begin(),
       m_params.end(),
       [&](const Param &p) { return p.first == name; });
 
-  if (foundParam != m_params.end())
-    m_params.erase(foundParam);
+  if (foundParam == m_params.end())
+    return false;
+
+  m_params.erase(foundParam);
+  return true;
 }
 
-void ParameterizedObject::removeAllParams()
+bool ParameterizedObject::removeAllParams()
 {
+  const bool hadParams = !m_params.empty();
   m_params.clear();
+  return hadParams;
 }
 
 ParameterizedObject::ParameterList::iterator ParameterizedObject::params_begin()
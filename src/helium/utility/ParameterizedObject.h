@@ -22,12 +22,14 @@ struct ParameterizedObject
   // Return true if there was a parameter set with the corresponding 'name'
   bool hasParam(const std::string &name);
 
-  // Set the value of the parameter 'name', or add it if it doesn't exist yet
-  void setParam(const std::string &name, ANARIDataType type, const void *v);
+  // Set the value of the parameter 'name', or add it if it doesn't exist yet.
+  // Returns false if the parameter already held an identical value.
+  bool setParam(const std::string &name, ANARIDataType type, const void *v);
 
-  // Set the value of the parameter 'name', or add it if it doesn't exist yet
+  // Set the value of the parameter 'name', or add it if it doesn't exist yet.
+  // Returns false if the parameter already held an identical value.
   template <typename T>
-  void setParam(const std::string &name, const T &v);
+  bool setParam(const std::string &name, const T &v);
 
   // Get the value of the parameter associated with 'name', or return
   // 'valueIfNotFound' if the parameter isn't set. This is strongly typed by
@@ -64,11 +66,12 @@ struct ParameterizedObject
   AnariAny getParamDirect(const std::string &name);
   void setParamDirect(const std::string &name, const AnariAny &v);
 
-  // Remove the value of the parameter associated with 'name'.
-  void removeParam(const std::string &name);
+  // Remove the value of the parameter associated with 'name', returns whether
+  // there was one to remove.
+  bool removeParam(const std::string &name);
 
-  // Remove all set parameters
-  void removeAllParams();
+  // Remove all set parameters, returns whether there were any
+  bool removeAllParams();
 
  protected:
   using Param = std::pair<std::string, AnariAny>;
@@ -88,17 +91,17 @@ struct ParameterizedObject
 // Inlined ParameterizedObject definitions ////////////////////////////////////
 
 template <typename T>
-inline void ParameterizedObject::setParam(const std::string &name, const T &v)
+inline bool ParameterizedObject::setParam(const std::string &name, const T &v)
 {
   constexpr ANARIDataType type = anari::ANARITypeFor<T>::value;
-  setParam(name, type, &v);
+  return setParam(name, type, &v);
 }
 
 template <>
-inline void ParameterizedObject::setParam(
+inline bool ParameterizedObject::setParam(
     const std::string &name, const std::string &v)
 {
-  setParam(name, ANARI_STRING, v.c_str());
+  return setParam(name, ANARI_STRING, v.c_str());
 }
 
 template <typename T>
@@ -153,7 +153,7 @@ void *Device::mapArray(ANARIArray array)
   auto buf = std::make_shared<Buffer>();
   buf->write(remoteDevice);
   buf->write(array);
-  write(MessageType::MapArray, buf);
+  write(MessageType::MapArray, buf, {array});
 
   std::unique_lock l(sync[SyncPoints::MapArray].mtx);
   ArrayData &data = arrays[array];
@@ -173,7 +173,7 @@ void Device::unmapArray(ANARIArray array)
   buf->write(array);
   uint64_t numBytes = arrays[array].value.size();
   buf->write(arrays[array].value.data(), numBytes);
-  write(MessageType::UnmapArray, buf);
+  writeBulk(MessageType::UnmapArray, buf, array);
 
   std::unique_lock l(sync[SyncPoints::MapArray].mtx);
   ArrayData &data = arrays[array];
@@ -194,7 +194,9 @@ ANARILight Device::newLight(const char *type)
 
 ANARICamera Device::newCamera(const char *type)
 {
-  return (ANARICamera)registerNewObject(ANARI_CAMERA, type);
+  ANARIObject camera = registerNewObject(ANARI_CAMERA, type);
+  cameras[camera].params.type = type;
+  return (ANARICamera)camera;
 }
 
 ANARIGeometry Device::newGeometry(const char *type)
@@ -279,6 +281,30 @@ void Device::setParameter(
     return;
   }
 
+  // Server-side file backing of array data, sent when the array is committed
+  if (strcmp(name, "remote.filename") == 0 && type == ANARI_STRING) {
+    arrayFileSources[object].filename = std::string((const char *)mem);
+    return;
+  } else if (strcmp(name, "remote.fileOffset") == 0 && type == ANARI_UINT64) {
+    arrayFileSources[object].offset = *(const uint64_t *)mem;
+    return;
+  }
+
+  // Client-side reprojection; apart from "remote.reprojection" itself these
+  // parameters are passed to the server as well
+  auto camera = cameras.find(object);
+  if (camera != cameras.end())
+    camera->second.params.setParameter(name, type, mem);
+
+  auto frame = frames.find(object);
+  if (frame != frames.end()) {
+    if (strcmp(name, "remote.reprojection") == 0 && type == ANARI_BOOL) {
+      frame->second.params.reprojection = *(const bool *)mem;
+      return;
+    } else if (strcmp(name, "camera") == 0 && type == ANARI_CAMERA)
+      frame->second.params.camera = *(const ANARIObject *)mem;
+  }
+
   // Object parameters passed to the server
   std::vector<char> value;
   if (anari::isObject(type)) {
@@ -295,7 +321,9 @@ void Device::setParameter(
   buf->write(std::string(name));
   buf->write(type);
   buf->write(value.data(), value.size());
-  write(MessageType::SetParam, buf);
+  ANARIObject objectValue =
+      anari::isObject(type) ? *(const ANARIObject *)mem : nullptr;
+  write(MessageType::SetParam, buf, {object, objectValue});
 
   LOG(logging::Level::Info)
       << "Parameter " << name << " set on object " << object;
@@ -313,7 +341,7 @@ void Device::unsetParameter(ANARIObject object, const char *name)
   buf->write((const char *)&object, sizeof(object));
   uint64_t nameLen = strlen(name);
   buf->write(std::string(name));
-  write(MessageType::UnsetParam, buf);
+  write(MessageType::UnsetParam, buf, {object});
 
   LOG(logging::Level::Info)
       << "Parameter " << name << " unset on object " << object;
@@ -329,7 +357,7 @@ void Device::unsetAllParameters(ANARIObject object)
   auto buf = std::make_shared<Buffer>();
   buf->write(remoteDevice);
   buf->write(object);
-  write(MessageType::UnsetAllParams, buf);
+  write(MessageType::UnsetAllParams, buf, {object});
 
   LOG(logging::Level::Info)
       << "All parameters unset on object unset on object " << object;
@@ -350,10 +378,35 @@ void Device::commitParameters(ANARIObject object)
     write(
         MessageType::CommitParams, buf); // one handle only: commit the device!
   } else {
+    auto fileSource = arrayFileSources.find(object);
+    if (fileSource != arrayFileSources.end()) {
+      if (!fileSource->second.filename.empty()) {
+        auto buf = std::make_shared<Buffer>();
+        buf->write(remoteDevice);
+        buf->write(object);
+        buf->write(fileSource->second.filename);
+        buf->write(fileSource->second.offset);
+        write(MessageType::ReadArrayFile, buf, {object});
+
+        LOG(logging::Level::Info)
+            << "Array " << object << " reads server-side file "
+            << fileSource->second.filename;
+      }
+      arrayFileSources.erase(fileSource);
+    }
+
+    auto camera = cameras.find(object);
+    if (camera != cameras.end())
+      camera->second.committed = camera->second.params;
+
+    auto frame = frames.find(object);
+    if (frame != frames.end())
+      frame->second.committed = frame->second.params;
+
     auto buf = std::make_shared<Buffer>();
     buf->write(remoteDevice);
     buf->write(object);
-    write(MessageType::CommitParams, buf);
+    write(MessageType::CommitParams, buf, {object});
 
     LOG(logging::Level::Info) << "Parameters committed on object " << object;
   }
@@ -370,10 +423,13 @@ void Device::release(ANARIObject object)
   if (frames.find(object) != frames.end())
     frames.erase(object);
 
+  arrayFileSources.erase(object);
+  cameras.erase(object);
+
   auto buf = std::make_shared<Buffer>();
   buf->write(remoteDevice);
   buf->write(object);
-  write(MessageType::Release, buf);
+  write(MessageType::Release, buf, {object});
 
   LOG(logging::Level::Info) << "Object released: " << object;
 }
@@ -388,7 +444,7 @@ void Device::retain(ANARIObject object)
   auto buf = std::make_shared<Buffer>();
   buf->write(remoteDevice);
   buf->write(object);
-  write(MessageType::Retain, buf);
+  write(MessageType::Retain, buf, {object});
 
   LOG(logging::Level::Info) << "Object retained: " << object;
 }
@@ -414,7 +470,7 @@ int Device::getProperty(ANARIObject object,
   buf->write(type);
   buf->write(size);
   buf->write(mask);
-  write(MessageType::GetProperty, buf);
+  write(MessageType::GetProperty, buf, {object});
 
   std::unique_lock l(sync[SyncPoints::Properties].mtx);
   property.object = nullptr;
@@ -587,7 +643,9 @@ const void *Device::getParameterInfo(ANARIDataType objectType,
 
 ANARIFrame Device::newFrame()
 {
-  return (ANARIFrame)registerNewObject(ANARI_FRAME);
+  ANARIObject frame = registerNewObject(ANARI_FRAME);
+  frames[frame];
+  return (ANARIFrame)frame;
 }
 
 const void *Device::frameBufferMap(ANARIFrame fb,
@@ -603,6 +661,29 @@ const void *Device::frameBufferMap(ANARIFrame fb,
 
   Frame &frm = frames[fb];
 
+  // While a frame is in flight the last one is shown, reprojected to the
+  // current camera, instead of waiting
+  if (frm.committed.reprojection) {
+    if (frm.renderPending && frm.state != Frame::Render)
+      sendRenderFrame(fb, frm);
+
+    if (frm.state == Frame::Render
+        && (frm.previewMapped
+            || frm.reproject(committedCamera(frm.committed.camera)))) {
+      frm.previewMapped = true;
+      *width = frm.history.size[0];
+      *height = frm.history.size[1];
+      if (strncmp(channel, "channel.color", 13) == 0) {
+        *pixelType = frm.history.colorType;
+        return frm.previewColor.data();
+      } else if (strncmp(channel, "channel.depth", 13) == 0) {
+        *pixelType = ANARI_FLOAT32;
+        return frm.previewDepth.data();
+      }
+      return nullptr;
+    }
+  }
+
   // this is a no-op if we already waited:
   frameReady(fb, ANARI_WAIT);
 
@@ -632,7 +713,11 @@ void Device::frameBufferUnmap(ANARIFrame fb, const char *channel)
   }
 
   Frame &frm = frames[fb];
-  frm.state = Frame::Unmapped; // this needs to be done on a per-channel level!!
+  frm.previewMapped = false;
+  // Previews leave the frame in flight. Unmapping needs to be done on a
+  // per-channel level!!
+  if (frm.state == Frame::Mapped)
+    frm.state = Frame::Unmapped;
 }
 
 //--- Frame Rendering ---------------------------------
@@ -661,13 +746,44 @@ void Device::renderFrame(ANARIFrame frame)
       l, [&]() { return frm.state != Frame::Mapped; });
   l.unlock();
 
+  // With reprojection only one frame is in flight at a time: the next one is
+  // sent once it arrives, with the camera as it is by then
+  if (frm.committed.reprojection && frm.state == Frame::Render) {
+    frm.renderPending = true;
+    return;
+  }
+
+  sendRenderFrame(frame, frm);
+}
+
+void Device::sendRenderFrame(ANARIFrame frame, Frame &frm)
+{
   auto buf = std::make_shared<Buffer>();
   buf->write(remoteDevice);
   buf->write(frame);
   write(MessageType::RenderFrame, buf);
+
+  // Ask for the frame right away so it arrives without anyone waiting on it
+  if (frm.committed.reprojection) {
+    frm.renderCamera = committedCamera(frm.committed.camera);
+    auto readyBuf = std::make_shared<Buffer>();
+    readyBuf->write(remoteDevice);
+    readyBuf->write(frame);
+    readyBuf->write(ANARIWaitMask(ANARI_WAIT));
+    write(MessageType::FrameReady, readyBuf);
+  }
+
+  frm.renderPending = false;
   frm.state = Frame::Render;
 }
 
+const CameraState &Device::committedCamera(ANARIObject camera) const
+{
+  static const CameraState unsupported;
+  auto it = cameras.find(camera);
+  return it != cameras.end() ? it->second.committed : unsupported;
+}
+
 int Device::frameReady(ANARIFrame frame, ANARIWaitMask m)
 {
   if (!frame) {
@@ -677,6 +793,21 @@ int Device::frameReady(ANARIFrame frame, ANARIWaitMask m)
 
   Frame &frm = frames[frame];
 
+  // FrameReady was already sent along with the frame, see sendRenderFrame()
+  if (frm.committed.reprojection) {
+    if (frm.renderPending && frm.state != Frame::Render)
+      sendRenderFrame(frame, frm);
+    if (frm.state != Frame::Render)
+      return true;
+    if (m != ANARI_WAIT)
+      return false;
+
+    std::unique_lock l(sync[SyncPoints::FrameIsReady].mtx);
+    sync[SyncPoints::FrameIsReady].cv.wait(
+        l, [&]() { return frm.state == Frame::Ready; });
+    return true;
+  }
+
   if (m != ANARI_WAIT) {
     if (frm.frameID == 0)
       LOG(logging::Level::Warning)
@@ -793,7 +924,15 @@ ANARIArray Device::registerNewArray(ANARIDataType type,
   if (appMemory)
     buf->write((const char *)appMemory, info.getSizeInBytes());
 
-  write(MessageType::NewArray, buf);
+  // The data was copied into the message, so the app's memory is no longer
+  // needed even though the array lives on
+  if (appMemory && deleter)
+    deleter(userPtr, appMemory);
+
+  if (appMemory)
+    writeBulk(MessageType::NewArray, buf, array);
+  else
+    write(MessageType::NewArray, buf);
 
   LOG(logging::Level::Info)
       << "Array created: " << anari::toString(type) << ", sending "
@@ -858,6 +997,45 @@ void Device::write(unsigned type, std::shared_ptr<Buffer> buf)
   queue.post(std::bind(&Device::writeImpl, this, type, buf));
 }
 
+void Device::write(unsigned type,
+    std::shared_ptr<Buffer> buf,
+    std::initializer_list<ANARIObject> dependencies)
+{
+  if (!remoteDevice)
+    initClient();
+
+  // Post while holding the lock so bulk messages reach the transport in the
+  // order they were counted in
+  std::lock_guard<std::mutex> l(bulk.mtx);
+
+  uint64_t bulkDependency = 0;
+  for (auto o : dependencies) {
+    auto it = bulk.lastMessage.find(o);
+    if (it != bulk.lastMessage.end())
+      bulkDependency = std::max(bulkDependency, it->second);
+  }
+
+  queue.post(std::bind(&Device::writeOnLane,
+      this,
+      type,
+      buf,
+      async::lane::control,
+      bulkDependency));
+}
+
+void Device::writeBulk(
+    unsigned type, std::shared_ptr<Buffer> buf, ANARIObject object)
+{
+  if (!remoteDevice)
+    initClient();
+
+  std::lock_guard<std::mutex> l(bulk.mtx);
+  bulk.lastMessage[object] = ++bulk.numMessages;
+
+  queue.post(
+      std::bind(&Device::writeOnLane, this, type, buf, async::lane::bulk, 0));
+}
+
 void Device::write(unsigned type, const void *begin, const void *end)
 {
   if (!remoteDevice)
@@ -951,10 +1129,33 @@ void Device::handleMessage(async::connection::reason reason,
       assert(message->size() == sizeof(Handle));
       ANARIObject hnd = *(ANARIObject *)message->data();
       Frame &frm = frames[hnd];
+      if (frm.committed.reprojection)
+        frm.updateHistory();
       frm.state = Frame::Ready;
       frm.frameID++;
       sync[SyncPoints::FrameIsReady].cv.notify_all();
       // LOG(logging::Level::Info) << "Frame state: " << frameState;
+    } else if (message->type() == MessageType::ArrayFileError) {
+      Buffer buf(message->data(), message->size());
+
+      Handle array;
+      std::string error;
+      buf.read(array);
+      buf.read(error);
+
+      LOG(logging::Level::Error) << "Array " << array
+                                 << " was not read from file: " << error;
+
+      if (auto statusCB = defaultStatusCallback()) {
+        std::string msg = "remote array not read from file: " + error;
+        statusCB(defaultStatusCallbackUserPtr(),
+            this_device(),
+            (ANARIObject)array,
+            ANARI_ARRAY,
+            ANARI_SEVERITY_ERROR,
+            ANARI_STATUS_INVALID_OPERATION,
+            msg.c_str());
+      }
     } else if (message->type() == MessageType::Property) {
       std::unique_lock l(sync[SyncPoints::Properties].mtx);
 
@@ -1201,6 +1402,17 @@ void Device::writeImpl(unsigned type, std::shared_ptr<Buffer> buf)
   conn->write(type, *buf);
 }
 
+void Device::writeOnLane(unsigned type,
+    std::shared_ptr<Buffer> buf,
+    async::lane lane,
+    uint64_t bulkDependency)
+{
+  auto msg = async::make_message(type, buf->begin(), buf->end());
+  msg->set_lane(lane);
+  msg->set_bulk_dependency(bulkDependency);
+  conn->write(msg);
+}
+
 void Device::writeImpl2(unsigned type, const void *begin, const void *end)
 {
   conn->write(type, (const char *)begin, (const char *)end);
@@ -5,6 +5,7 @@
 
 #include <anari/backend/DeviceImpl.h>
 #include <condition_variable>
+#include <initializer_list>
 #include <map>
 #include <mutex>
 #include <vector>
@@ -180,6 +181,15 @@ struct Device : anari::DeviceImpl, helium::ParameterizedObject
   async::connection_pointer conn;
   async::work_queue queue;
 
+  // Number of bulk messages sent so far, and for each object the number
+  // including the last bulk message carrying its data
+  struct
+  {
+    std::mutex mtx;
+    uint64_t numMessages{0};
+    std::map<ANARIObject, uint64_t> lastMessage;
+  } bulk;
+
   struct SyncPrimitives
   {
     std::mutex mtx;
@@ -288,6 +298,18 @@ struct Device : anari::DeviceImpl, helium::ParameterizedObject
   std::vector<ParameterInfo::Ptr> parameterInfos;
 
   std::map<ANARIObject, Frame> frames;
+
+  // Client-side copies of camera parameters, used to reproject frames while
+  // the next one is in flight (see the "remote.reprojection" frame parameter)
+  struct CameraParams
+  {
+    CameraState params;
+    CameraState committed;
+  };
+  std::map<ANARIObject, CameraParams> cameras;
+
+  const CameraState &committedCamera(ANARIObject camera) const;
+  void sendRenderFrame(ANARIFrame frame, Frame &frm);
   struct ArrayData
   {
     ssize_t bytesExpected{-1};
@@ -309,6 +331,15 @@ struct Device : anari::DeviceImpl, helium::ParameterizedObject
   };
   std::map<ParameterArray, ANARIArray> parameterArrays;
 
+  // Arrays whose data the server reads from its own file system instead of
+  // receiving it over the connection, see the "remote.file*" array parameters
+  struct ArrayFileSource
+  {
+    std::string filename;
+    uint64_t offset{0};
+  };
+  std::map<ANARIObject, ArrayFileSource> arrayFileSources;
+
   ANARIObject registerNewObject(ANARIDataType type, std::string subtype = "");
   ANARIArray registerNewArray(ANARIDataType type,
       const void *appMemory,
@@ -327,6 +358,17 @@ struct Device : anari::DeviceImpl, helium::ParameterizedObject
   void write(unsigned type, std::shared_ptr<Buffer> buf);
   void write(unsigned type, const void *begin, const void *end);
 
+  // Control messages referring to objects whose data is still being sent on
+  // the bulk lane must not overtake it
+  void write(unsigned type,
+      std::shared_ptr<Buffer> buf,
+      std::initializer_list<ANARIObject> dependencies);
+
+  // Messages carrying (potentially large) array data for 'object' go on the
+  // transport's bulk lane so they don't hold up control and frame traffic
+  void writeBulk(
+      unsigned type, std::shared_ptr<Buffer> buf, ANARIObject object);
+
   bool handleNewConnection(
       async::connection_pointer new_conn, boost::system::error_code const &e);
 
@@ -335,6 +377,11 @@ struct Device : anari::DeviceImpl, helium::ParameterizedObject
       boost::system::error_code const &e);
 
   void writeImpl(unsigned type, std::shared_ptr<Buffer> buf);
+  // Sent on 'lane', after bulk message number 'bulkDependency' (if not 0)
+  void writeOnLane(unsigned type,
+      std::shared_ptr<Buffer> buf,
+      async::lane lane,
+      uint64_t bulkDependency);
   void writeImpl2(unsigned type, const void *begin, const void *end);
 
   //--- Stats -------------------------------------------
@@ -2,9 +2,108 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Frame.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
 
 namespace remote {
 
+using anari::math::float3;
+
+// Helper functions ///////////////////////////////////////////////////////////
+
+// Depths at or beyond this are rays which hit nothing
+constexpr float MISSED_DEPTH = 1e30f;
+
+// Orthonormal frame of a camera, maps between image coordinates in [0,1]^2
+// and world space the same way on both ends of the connection
+struct CameraBasis
+{
+  CameraBasis(const CameraState &c)
+      : ortho(c.type == "orthographic"), org(c.position)
+  {
+    fwd = linalg::normalize(c.direction);
+    right = linalg::normalize(linalg::cross(fwd, c.up));
+    up = linalg::cross(right, fwd);
+    extent.y = ortho ? c.height : 2.f * std::tan(0.5f * c.fovy);
+    extent.x = extent.y * c.aspect;
+  }
+
+  // Point at 'depth' along the ray through image position (sx, sy)
+  float3 point(float sx, float sy, float depth) const
+  {
+    const float3 offset =
+        right * ((sx - 0.5f) * extent.x) + up * ((sy - 0.5f) * extent.y);
+    if (ortho)
+      return org + offset + fwd * depth;
+    return org + linalg::normalize(fwd + offset) * depth;
+  }
+
+  // Image position and depth of 'p', false if it is behind the camera
+  bool project(const float3 &p, float &sx, float &sy, float &depth) const
+  {
+    const float3 v = p - org;
+    const float z = linalg::dot(v, fwd);
+    if (z <= 0.f)
+      return false;
+    const float scale = ortho ? 1.f : 1.f / z;
+    sx = linalg::dot(v, right) * scale / extent.x + 0.5f;
+    sy = linalg::dot(v, up) * scale / extent.y + 0.5f;
+    depth = ortho ? z : linalg::length(v);
+    return true;
+  }
+
+  // World space height of a pixel at 'depth' in an image 'height' pixels tall
+  float pixelSize(float depth, uint32_t height) const
+  {
+    return (ortho ? 1.f : depth) * extent.y / height;
+  }
+
+  bool ortho;
+  float3 org, fwd, right, up;
+  anari::math::float2 extent;
+};
+
+// CameraState definitions ////////////////////////////////////////////////////
+
+bool CameraState::isSupported() const
+{
+  return type == "perspective" || type == "orthographic";
+}
+
+void CameraState::setParameter(
+    const char *name, ANARIDataType type, const void *mem)
+{
+  if (type == ANARI_FLOAT32_VEC3) {
+    float3 v;
+    std::memcpy(&v, mem, sizeof(v));
+    if (strcmp(name, "position") == 0)
+      position = v;
+    else if (strcmp(name, "direction") == 0)
+      direction = v;
+    else if (strcmp(name, "up") == 0)
+      up = v;
+  } else if (type == ANARI_FLOAT32) {
+    const float f = *(const float *)mem;
+    if (strcmp(name, "fovy") == 0)
+      fovy = f;
+    else if (strcmp(name, "aspect") == 0)
+      aspect = f;
+    else if (strcmp(name, "height") == 0)
+      height = f;
+  }
+}
+
+bool CameraState::operator==(const CameraState &other) const
+{
+  return type == other.type && position == other.position
+      && direction == other.direction && up == other.up && fovy == other.fovy
+      && aspect == other.aspect && height == other.height;
+}
+
+// Frame definitions //////////////////////////////////////////////////////////
+
 void Frame::resizeColor(uint32_t width, uint32_t height, ANARIDataType type)
 {
   size_t newSize =
@@ -33,4 +132,118 @@ void Frame::resizeDepth(uint32_t width, uint32_t height, ANARIDataType type)
   }
 }
 
+void Frame::updateHistory()
+{
+  std::unique_lock l(historyMtx);
+
+  const size_t numPixels = size_t(size[0]) * size[1];
+  history.valid = colorType != ANARI_UNKNOWN && depthType == ANARI_FLOAT32
+      && color.size() == numPixels * anari::sizeOf(colorType)
+      && depth.size() == numPixels * sizeof(float);
+  if (!history.valid)
+    return;
+
+  history.camera = renderCamera;
+  history.size[0] = size[0];
+  history.size[1] = size[1];
+  history.colorType = colorType;
+  history.color = color;
+  history.depth.resize(numPixels);
+  std::memcpy(history.depth.data(), depth.data(), depth.size());
+}
+
+bool Frame::reproject(const CameraState &to)
+{
+  std::unique_lock l(historyMtx);
+
+  if (!history.valid || !history.camera.isSupported() || !to.isSupported())
+    return false;
+
+  const uint32_t width = history.size[0];
+  const uint32_t height = history.size[1];
+  const size_t numPixels = size_t(width) * height;
+  const size_t pixelSize = anari::sizeOf(history.colorType);
+  const CameraBasis src(history.camera);
+  const CameraBasis dst(to);
+
+  // Forward-splat every pixel which hit something into the new view as a
+  // square about as big as it appears there, keeping the closest. Pixels
+  // nothing lands on keep the old image for now.
+  previewColor = history.color;
+  previewDepth.assign(numPixels, std::numeric_limits<float>::infinity());
+
+  for (uint32_t y = 0; y < height; y++) {
+    for (uint32_t x = 0; x < width; x++) {
+      const size_t i = size_t(y) * width + x;
+      const float d = history.depth[i];
+      if (!(d < MISSED_DEPTH))
+        continue;
+
+      const float3 p = src.point((x + 0.5f) / width, (y + 0.5f) / height, d);
+      float sx, sy, newDepth;
+      if (!dst.project(p, sx, sy, newDepth))
+        continue;
+
+      const float footprint =
+          src.pixelSize(d, height) / dst.pixelSize(newDepth, height);
+      const int size = std::clamp(int(std::ceil(footprint - 0.01f)), 1, 4);
+      const int px = int(std::floor(sx * width - 0.5f * (size - 1)));
+      const int py = int(std::floor(sy * height - 0.5f * (size - 1)));
+      const int xEnd = std::min(px + size, int(width));
+      const int yEnd = std::min(py + size, int(height));
+      for (int ty = std::max(py, 0); ty < yEnd; ty++) {
+        for (int tx = std::max(px, 0); tx < xEnd; tx++) {
+          const size_t j = size_t(ty) * width + tx;
+          if (newDepth < previewDepth[j]) {
+            previewDepth[j] = newDepth;
+            std::memcpy(previewColor.data() + j * pixelSize,
+                history.color.data() + i * pixelSize,
+                pixelSize);
+          }
+        }
+      }
+    }
+  }
+
+  // Cracks and disocclusions which still show old geometry are filled, row
+  // by row, from whichever end of the gap is farther away since that is more
+  // likely what was hidden. Background nothing landed on counts as farthest.
+  auto known = [&](size_t i) {
+    return previewDepth[i] < MISSED_DEPTH || !(history.depth[i] < MISSED_DEPTH);
+  };
+
+  for (uint32_t y = 0; y < height; y++) {
+    const size_t row = size_t(y) * width;
+    uint32_t x = 0;
+    while (x < width) {
+      if (known(row + x)) {
+        x++;
+        continue;
+      }
+
+      const uint32_t begin = x;
+      while (x < width && !known(row + x))
+        x++;
+
+      const bool hasLeft = begin > 0;
+      const bool hasRight = x < width;
+      if (!hasLeft && !hasRight)
+        continue;
+
+      size_t src = hasLeft ? row + begin - 1 : row + x;
+      if (hasLeft && hasRight && previewDepth[row + x] > previewDepth[src])
+        src = row + x;
+
+      for (uint32_t i = begin; i < x; i++) {
+        previewDepth[row + i] = previewDepth[src];
+        std::memcpy(previewColor.data() + (row + i) * pixelSize,
+            previewColor.data() + src * pixelSize,
+            pixelSize);
+      }
+    }
+  }
+
+  return true;
+}
+
 } // namespace remote
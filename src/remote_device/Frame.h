@@ -4,10 +4,30 @@
 #pragma once
 
 #include <anari/anari_cpp.hpp>
+#include <anari/anari_cpp/ext/linalg.h>
+#include <mutex>
+#include <string>
 #include <vector>
 
 namespace remote {
 
+// Client-side copy of the parameters of a perspective or orthographic camera,
+// just enough to reproject frames rendered with it
+struct CameraState
+{
+  std::string type;
+  anari::math::float3 position{0.f, 0.f, 0.f};
+  anari::math::float3 direction{0.f, 0.f, -1.f};
+  anari::math::float3 up{0.f, 1.f, 0.f};
+  float fovy{1.0471975512f}; // pi/3
+  float aspect{1.f};
+  float height{1.f};
+
+  bool isSupported() const;
+  void setParameter(const char *name, ANARIDataType type, const void *mem);
+  bool operator==(const CameraState &other) const;
+};
+
 struct Frame
 {
   enum State
@@ -30,6 +50,41 @@ struct Frame
 
   std::vector<uint8_t> color;
   std::vector<uint8_t> depth;
+
+  //--- Client-side reprojection --------------------
+
+  // "remote.reprojection" and "camera" as last set and as committed
+  struct
+  {
+    bool reprojection{false};
+    ANARIObject camera{nullptr};
+  } params, committed;
+
+  // renderFrame() was called while another frame was still in flight
+  bool renderPending{false};
+  CameraState renderCamera; // camera of the frame in flight
+
+  // The last frame received, which is warped to the current camera while
+  // the next one is in flight. Filled in on the connection's thread.
+  std::mutex historyMtx;
+  struct
+  {
+    bool valid{false};
+    CameraState camera;
+    uint32_t size[2] = {0, 0};
+    ANARIDataType colorType = ANARI_UNKNOWN;
+    std::vector<uint8_t> color;
+    std::vector<float> depth;
+  } history;
+
+  void updateHistory();
+
+  // Returned by frameBufferMap() instead of the channels while in flight
+  bool previewMapped{false};
+  std::vector<uint8_t> previewColor;
+  std::vector<float> previewDepth;
+
+  bool reproject(const CameraState &to);
 };
 
 } // namespace remote
@@ -2,9 +2,19 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <anari/anari_cpp.hpp>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <functional>
 #include <iostream>
 #include <sstream>
+#include <thread>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include "ArrayInfo.h"
 #include "Buffer.h"
 #include "Compression.h"
@@ -21,6 +31,7 @@ static std::string g_libraryType = "environment";
 static ANARILibrary g_library = nullptr;
 static bool g_verbose = false;
 static unsigned short g_port = 31050;
+static std::string g_dataRoot;
 
 namespace remote {
 
@@ -122,6 +133,147 @@ static ANARIArray newArray(
   return array;
 }
 
+// Resolve a client supplied path against the data root given on the command
+// line. Files outside of it (including via symlinks or "..") are rejected, and
+// without a data root no files can be read at all.
+static bool resolveDataPath(
+    const std::string &filename, std::string &resolved, std::string &error)
+{
+  namespace fs = std::filesystem;
+
+  if (g_dataRoot.empty()) {
+    error = "reading array files is disabled, start the server with "
+            "--data-root to enable it";
+    return false;
+  }
+
+  std::error_code ec;
+  fs::path root = fs::canonical(g_dataRoot, ec);
+  if (ec) {
+    error = "invalid data root " + g_dataRoot;
+    return false;
+  }
+
+  fs::path path = fs::path(filename);
+  if (path.is_relative())
+    path = root / path;
+  path = fs::canonical(path, ec);
+  if (ec) {
+    error = "cannot open array file " + filename;
+    return false;
+  }
+
+  auto mismatch =
+      std::mismatch(root.begin(), root.end(), path.begin(), path.end());
+  if (mismatch.first != root.end()) {
+    error = "array file " + filename + " is outside of the data root";
+    return false;
+  }
+
+  resolved = path.string();
+  return true;
+}
+
+// Fill an array with data read directly from a file on the server, so the data
+// never has to travel over the connection to the client. The file is read
+// with one positional read per worker thread into a staging buffer, which is
+// copied into the array once all of it was read. On failure the array is left
+// untouched and the reason is returned in 'error' for the client.
+static bool readArrayFile(ANARIDevice dev,
+    ANARIArray array,
+    const ArrayInfo &info,
+    const std::string &filename,
+    uint64_t offset,
+    std::string &error)
+{
+  if (anari::isObject(info.elementType)) {
+    error = "arrays of objects cannot be read from files";
+    return false;
+  }
+
+  std::string path;
+  if (!resolveDataPath(filename, path, error))
+    return false;
+
+  const size_t numBytes = info.getSizeInBytes();
+
+#ifndef _WIN32
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    error = "cannot open array file " + filename;
+    return false;
+  }
+
+  struct stat sb;
+  if (fstat(fd, &sb) != 0 || uint64_t(sb.st_size) < offset + numBytes) {
+    error = "array file " + filename + " is too small, need "
+        + prettyBytes(offset + numBytes);
+    close(fd);
+    return false;
+  }
+
+  // Read into a staging buffer first, so a failed read leaves the array as
+  // it was
+  std::vector<char> staging(numBytes);
+  char *dst = staging.data();
+
+  constexpr size_t minBytesPerThread = 16 << 20;
+  const size_t numThreads = std::clamp(numBytes / minBytesPerThread,
+      size_t(1),
+      size_t(std::max(1u, std::thread::hardware_concurrency())));
+  const size_t bytesPerThread = (numBytes + numThreads - 1) / numThreads;
+
+  std::vector<std::thread> threads;
+  std::vector<char> ok(numThreads, 1);
+  for (size_t t = 0; t < numThreads; ++t) {
+    threads.emplace_back([&, t]() {
+      size_t begin = std::min(t * bytesPerThread, numBytes);
+      size_t end = std::min(begin + bytesPerThread, numBytes);
+      while (begin < end) {
+        ssize_t n = pread(fd, dst + begin, end - begin, offset + begin);
+        if (n <= 0) {
+          ok[t] = 0;
+          return;
+        }
+        begin += n;
+      }
+    });
+  }
+
+  for (auto &t : threads)
+    t.join();
+
+  close(fd);
+
+  const bool success = std::all_of(ok.begin(), ok.end(), [](char c) {
+    return c != 0;
+  });
+#else
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    error = "cannot open array file " + filename;
+    return false;
+  }
+
+  std::vector<char> staging(numBytes);
+  file.seekg(offset);
+  file.read(staging.data(), numBytes);
+
+  const bool success = bool(file);
+#endif
+
+  if (!success) {
+    error = "failed reading array file " + filename;
+    return false;
+  }
+
+  void *ptr = anariMapArray(dev, array);
+  memcpy(ptr, staging.data(), numBytes);
+  anariUnmapArray(dev, array);
+
+  return true;
+}
+
 struct ServerObject
 {
   ANARIDevice device{nullptr};
@@ -262,11 +414,25 @@ struct Server
     queue.post(std::bind(&Server::writeImpl, this, type, buf));
   }
 
+  // Array data goes on the transport's bulk lane, so frames don't have to wait
+  // for it
+  void writeBulk(unsigned type, std::shared_ptr<Buffer> buf)
+  {
+    queue.post(std::bind(&Server::writeBulkImpl, this, type, buf));
+  }
+
   void writeImpl(unsigned type, std::shared_ptr<Buffer> buf)
   {
     conn->write(type, *buf);
   }
 
+  void writeBulkImpl(unsigned type, std::shared_ptr<Buffer> buf)
+  {
+    auto msg = async::make_message(type, buf->begin(), buf->end());
+    msg->set_lane(async::lane::bulk);
+    conn->write(msg);
+  }
+
   std::vector<uint8_t> translateArrayData(
       Buffer &buf, ANARIDevice dev, ArrayInfo info)
   {
@@ -430,6 +596,56 @@ struct Server
         LOG(logging::Level::Info)
             << "Creating new array, objectID: " << objectID
             << ", ANARI handle: " << anariArr;
+      } else if (message->type() == MessageType::ReadArrayFile) {
+        Buffer buf(message->data(), message->size());
+
+        Handle deviceHandle, objectHandle;
+        buf.read(deviceHandle);
+        buf.read(objectHandle);
+
+        std::string filename;
+        buf.read(filename);
+
+        uint64_t offset = 0;
+        buf.read(offset);
+
+        ANARIDevice dev = resourceManager.getDevice(deviceHandle);
+
+        ServerObject serverObj =
+            resourceManager.getServerObject(deviceHandle, objectHandle);
+
+        std::string error;
+        if (!dev || !serverObj.handle || !anari::isArray(serverObj.type)) {
+          error = "invalid array handle";
+        } else {
+          ArrayInfo info =
+              resourceManager.getArrayInfo(deviceHandle, objectHandle);
+
+          auto start = std::chrono::steady_clock::now();
+          if (readArrayFile(dev,
+                  (ANARIArray)serverObj.handle,
+                  info,
+                  filename,
+                  offset,
+                  error)) {
+            auto end = std::chrono::steady_clock::now();
+            LOG(logging::Level::Stats)
+                << "Read " << prettyBytes(info.getSizeInBytes()) << " from "
+                << filename << " in "
+                << std::chrono::duration<double>(end - start).count() << "s";
+          }
+        }
+
+        if (!error.empty()) {
+          LOG(logging::Level::Error)
+              << "Server: error reading file into array " << objectHandle
+              << ": " << error;
+
+          auto outbuf = std::make_shared<Buffer>();
+          outbuf->write(objectHandle);
+          outbuf->write(error);
+          write(MessageType::ArrayFileError, outbuf);
+        }
       } else if (message->type() == MessageType::SetParam) {
         Buffer buf(message->data(), message->size());
 
@@ -645,7 +861,7 @@ struct Server
         outbuf->write(objectHandle);
         outbuf->write(numBytes);
         outbuf->write((const char *)ptr, numBytes);
-        write(MessageType::ArrayMapped, outbuf);
+        writeBulk(MessageType::ArrayMapped, outbuf);
 
         LOG(logging::Level::Info) << "Mapped array. Handle: " << objectHandle;
       } else if (message->type() == MessageType::UnmapArray) {
@@ -1057,7 +1273,8 @@ static void printUsage()
   std::cout << "./anari-remote-server [{--help|-h}]\n"
             << "   [{--verbose|-v}]\n"
             << "   [{--library|-l} <ANARI library>]\n"
-            << "   [{--port|-p} <N>]\n";
+            << "   [{--port|-p} <N>]\n"
+            << "   [{--data-root|-d} <directory>]\n";
 }
 
 static void parseCommandLine(int argc, char *argv[])
@@ -1073,6 +1290,8 @@ static void parseCommandLine(int argc, char *argv[])
       g_libraryType = argv[++i];
     else if (arg == "-p" || arg == "--port")
       g_port = std::stoi(argv[++i]);
+    else if (arg == "-d" || arg == "--data-root")
+      g_dataRoot = argv[++i];
   }
 }
 
@@ -10,6 +10,7 @@
 #endif
 #endif
 
+#include <map>
 #include <memory>
 
 #include <boost/asio/io_service.hpp>
@@ -96,6 +97,8 @@ class connection : public std::enable_shared_from_this<connection>
   signal_type signal_;
   // Slot
   boost::signals2::connection slot_;
+  // Bulk messages of which only some chunks have been read yet
+  std::map<boost::uuids::uuid, message_pointer> partial_messages_;
 };
 
 } // namespace async
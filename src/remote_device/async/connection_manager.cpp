@@ -1,6 +1,7 @@
 // Copyright 2023-2024 The Khronos Group
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
 #include <cstdio>
 #include <sstream>
 
@@ -18,6 +19,10 @@ using namespace async;
 
 using boost::asio::ip::tcp;
 
+// Size of the chunks bulk messages are split into. Control messages wait for
+// at most one chunk to be written.
+static constexpr size_t bulk_chunk_size = 1 << 20;
+
 //--------------------------------------------------------------------------------------------------
 // Misc.
 //
@@ -335,6 +340,15 @@ void connection_manager::handle_read_data(boost::system::error_code const &e,
     message_pointer message,
     connection_pointer conn)
 {
+  if (!e && message->header_.is_chunk()) {
+    message = assemble_chunk(message, conn);
+    if (!message) {
+      // Wait for the remaining chunks
+      do_read(conn);
+      return;
+    }
+  }
+
   // Call the connection's slot
   conn->signal_(connection::Read, message, e);
 
@@ -350,6 +364,32 @@ void connection_manager::handle_read_data(boost::system::error_code const &e,
   }
 }
 
+message_pointer connection_manager::assemble_chunk(
+    message_pointer chunk, connection_pointer conn)
+{
+  auto const &h = chunk->header_;
+
+  message_pointer &msg = conn->partial_messages_[h.id_];
+  if (!msg) {
+    msg = make_message(h.type_);
+    msg->data_.resize(h.total_size_);
+    msg->header_ = message::header(h.id_, h.type_, h.total_size_);
+  }
+
+  assert(h.chunk_offset_ + h.size_ <= msg->data_.size());
+  std::copy(chunk->data_.begin(),
+      chunk->data_.end(),
+      msg->data_.begin() + h.chunk_offset_);
+
+  // Chunks are written in order
+  if (h.chunk_offset_ + h.size_ != h.total_size_)
+    return message_pointer();
+
+  message_pointer complete = msg;
+  conn->partial_messages_.erase(h.id_);
+  return complete;
+}
+
 void connection_manager::write(message_pointer msg, connection_pointer conn)
 {
   strand_.post(boost::bind(&connection_manager::do_write, this, msg, conn));
@@ -357,42 +397,92 @@ void connection_manager::write(message_pointer msg, connection_pointer conn)
 
 void connection_manager::do_write(message_pointer msg, connection_pointer conn)
 {
-  write_queue_.push_back(std::make_pair(conn, msg));
+  if (msg->lane() == lane::bulk)
+    bulk_queue_.push_back({conn, msg, num_control_queued_});
+  else {
+    write_queue_.push_back({conn, msg, msg->bulk_dependency()});
+    num_control_queued_++;
+  }
 
-  if (write_queue_.size() == 1) {
+  if (!writing_) {
     do_write_0();
   }
 }
 
 void connection_manager::do_write_0()
 {
+  // Control messages have strict priority, unless they refer to data which is
+  // still in flight on the bulk lane. Bulk messages in turn never overtake
+  // control messages queued before them (e.g. creating objects they refer to).
+  bool control_ready = !write_queue_.empty()
+      && num_bulk_written_ >= write_queue_.front().after;
+  bool bulk_ready =
+      !bulk_queue_.empty() && num_control_written_ >= bulk_queue_.front().after;
+
+  writing_ = control_ready || bulk_ready;
+
+  if (!control_ready) {
+    if (bulk_ready) {
+      do_write_chunk();
+    }
+    return;
+  }
+
   // Get the next message from the queue
-  std::pair<connection_pointer, message_pointer> msg = write_queue_.front();
+  pending_write msg = write_queue_.front();
 
   //
   // TODO:
   // Need to serialize the message-header!
   //
 
-  assert(msg.second->header_.size_ != 0);
-  assert(msg.second->header_.size_ == msg.second->data_.size());
+  assert(msg.msg->header_.size_ != 0);
+  assert(msg.msg->header_.size_ == msg.msg->data_.size());
 
   // Send the header and the data in a single write operation.
   std::vector<boost::asio::const_buffer> buffers;
 
-  buffers.push_back(boost::asio::const_buffer(
-      &msg.second->header_, sizeof(msg.second->header_)));
-  buffers.push_back(boost::asio::const_buffer(
-      &msg.second->data_[0], msg.second->data_.size()));
+  buffers.push_back(
+      boost::asio::const_buffer(&msg.msg->header_, sizeof(msg.msg->header_)));
+  buffers.push_back(
+      boost::asio::const_buffer(&msg.msg->data_[0], msg.msg->data_.size()));
 
   // Start the write operation.
-  boost::asio::async_write(msg.first->socket_,
+  boost::asio::async_write(msg.conn->socket_,
       buffers,
       boost::bind(&connection_manager::handle_write,
           this,
           boost::asio::placeholders::error,
-          msg.second,
-          msg.first));
+          msg.msg,
+          msg.conn));
+}
+
+void connection_manager::do_write_chunk()
+{
+  pending_write msg = bulk_queue_.front();
+
+  auto const &h = msg.msg->header_;
+  size_t size = std::min(bulk_chunk_size, msg.msg->data_.size() - bulk_offset_);
+
+  chunk_header_ = h;
+  chunk_header_.size_ = static_cast<unsigned>(size);
+  chunk_header_.chunk_offset_ = static_cast<unsigned>(bulk_offset_);
+  chunk_header_.total_size_ = h.size_;
+
+  std::vector<boost::asio::const_buffer> buffers;
+
+  buffers.push_back(
+      boost::asio::const_buffer(&chunk_header_, sizeof(chunk_header_)));
+  buffers.push_back(
+      boost::asio::const_buffer(&msg.msg->data_[bulk_offset_], size));
+
+  boost::asio::async_write(msg.conn->socket_,
+      buffers,
+      boost::bind(&connection_manager::handle_write_chunk,
+          this,
+          boost::asio::placeholders::error,
+          msg.msg,
+          msg.conn));
 }
 
 void connection_manager::handle_write(boost::system::error_code const &e,
@@ -404,18 +494,46 @@ void connection_manager::handle_write(boost::system::error_code const &e,
 
   // Remove the message from the queue
   write_queue_.pop_front();
+  num_control_written_++;
 
   if (!e) {
     // Message successfully sent.
     // Send the next one -- if any.
-    if (!write_queue_.empty()) {
-      do_write_0();
-    }
+    do_write_0();
   } else {
 #ifndef NDEBUG
     printf("connection_manager::handle_write: %s", e.message().c_str());
 #endif
 
+    writing_ = false;
+    remove_connection(conn);
+  }
+}
+
+void connection_manager::handle_write_chunk(boost::system::error_code const &e,
+    message_pointer message,
+    connection_pointer conn)
+{
+  bulk_offset_ += chunk_header_.size_;
+
+  const bool done = e || bulk_offset_ == message->data_.size();
+  if (done) {
+    // Call the connection's slot
+    conn->signal_(connection::Write, message, e);
+
+    bulk_queue_.pop_front();
+    bulk_offset_ = 0;
+    num_bulk_written_++;
+  }
+
+  if (!e) {
+    do_write_0();
+  } else {
+#ifndef NDEBUG
+    printf("connection_manager::handle_write_chunk: %s", e.message().c_str());
+#endif
+
+    writing_ = false;
     remove_connection(conn);
   }
 }
@@ -105,14 +105,26 @@ class connection_manager
   // Starts a new write operation.
   void do_write(message_pointer msg, connection_pointer conn);
 
-  // Write the next message
+  // Write the next message (or bulk message chunk)
   void do_write_0();
 
+  // Write the next chunk of the bulk message at the front of the bulk queue
+  void do_write_chunk();
+
   // Called when a complete message is written.
   void handle_write(boost::system::error_code const &e,
       message_pointer message,
       connection_pointer conn);
 
+  // Called when a chunk of a bulk message is written.
+  void handle_write_chunk(boost::system::error_code const &e,
+      message_pointer message,
+      connection_pointer conn);
+
+  // Add a read chunk to its message, returns the message once it is complete
+  message_pointer assemble_chunk(
+      message_pointer chunk, connection_pointer conn);
+
   // Add a new connection
   void add_connection(connection_pointer conn);
 
@@ -120,8 +132,17 @@ class connection_manager
   void remove_connection(connection_pointer conn);
 
  private:
+  struct pending_write
+  {
+    connection_pointer conn;
+    message_pointer msg;
+    // Control messages: number of bulk messages which must be written first.
+    // Bulk messages: number of control messages which must be written first.
+    uint64_t after;
+  };
+
   using connections = std::set<connection_pointer>;
-  using messages = std::deque<std::pair<connection_pointer, message_pointer>>;
+  using messages = std::deque<pending_write>;
 
   // The IO service
   boost::asio::io_service io_service_;
@@ -133,8 +154,21 @@ class connection_manager
   std::shared_ptr<boost::asio::io_service::work> work_;
   // The list of active connections
   connections connections_;
-  // List of messages to be written
+  // List of (control) messages to be written
   messages write_queue_;
+  // List of bulk messages to be written, in chunks, when there is no control
+  // traffic which is ready to go
+  messages bulk_queue_;
+  // Bytes of the front bulk message which have been written
+  size_t bulk_offset_ = 0;
+  // Header of the bulk message chunk currently being written
+  message::header chunk_header_;
+  // Counters to keep dependent messages in order across lanes
+  uint64_t num_control_queued_ = 0;
+  uint64_t num_control_written_ = 0;
+  uint64_t num_bulk_written_ = 0;
+  // Whether a write operation is in progress
+  bool writing_ = false;
   // A thread to process the message queue
   std::thread runner_;
 };
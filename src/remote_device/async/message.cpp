@@ -17,11 +17,17 @@ using namespace async;
 // message::header
 //
 
-message::header::header() : id_(boost::uuids::nil_uuid()), type_(0), size_(0) {}
+message::header::header()
+    : id_(boost::uuids::nil_uuid()),
+      type_(0),
+      size_(0),
+      chunk_offset_(0),
+      total_size_(0)
+{}
 
 message::header::header(
     boost::uuids::uuid const &id, unsigned type, unsigned size)
-    : id_(id), type_(type), size_(size)
+    : id_(id), type_(type), size_(size), chunk_offset_(0), total_size_(size)
 {}
 
 message::header::~header() {}
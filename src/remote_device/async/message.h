@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cassert>
+#include <cstdint>
 #include <memory>
 #include <stdexcept>
 #include <vector>
@@ -16,6 +17,14 @@ class message;
 
 using message_pointer = std::shared_ptr<message>;
 
+// Messages on the control lane are written before any pending bulk messages,
+// bulk messages are split into chunks so control traffic can be interleaved
+enum class lane
+{
+  control,
+  bulk
+};
+
 //--------------------------------------------------------------------------------------------------
 // message
 //
@@ -31,12 +40,22 @@ class message
     boost::uuids::uuid id_; // POD, 16 bytes
     // The type of this message
     unsigned type_;
-    // The length of this message
+    // The length of this message (or chunk)
     unsigned size_;
+    // Bulk messages are sent in chunks: the offset of this chunk's data and
+    // the length of the whole message
+    unsigned chunk_offset_;
+    unsigned total_size_;
 
     header();
     header(boost::uuids::uuid const &id, unsigned type, unsigned size);
 
+    // Returns whether this header belongs to a chunk of a larger message
+    bool is_chunk() const
+    {
+      return size_ != total_size_;
+    }
+
     ~header();
   };
 
@@ -48,6 +67,10 @@ class message
   data_type data_;
   // The message header
   header header_;
+  // The lane this message is written on
+  async::lane lane_ = async::lane::control;
+  // Number of bulk messages which must be written before this one
+  uint64_t bulk_dependency_ = 0;
 
  public:
   message();
@@ -106,6 +129,31 @@ class message
     return data_.end();
   }
 
+  // Returns the lane this message is written on
+  async::lane lane() const
+  {
+    return lane_;
+  }
+
+  // Sets the lane this message is written on
+  void set_lane(async::lane l)
+  {
+    lane_ = l;
+  }
+
+  // Returns the number of bulk messages which must be written before this
+  // (control) message, e.g. because it refers to the data they carry
+  uint64_t bulk_dependency() const
+  {
+    return bulk_dependency_;
+  }
+
+  // Sets the number of bulk messages which must be written before this one
+  void set_bulk_dependency(uint64_t n)
+  {
+    bulk_dependency_ = n;
+  }
+
   // Swaps the data buffer with the given buffer and resets the header.
   void swap_data(data_type &buffer)
   {
@@ -49,6 +49,8 @@ struct MessageType
     ParameterInfo,
     ChannelColor,
     ChannelDepth,
+    ReadArrayFile,
+    ArrayFileError,
   };
 };
 
@@ -111,6 +113,10 @@ inline const char *toString(unsigned mt)
     return "CannelColor";
   case MessageType::ChannelDepth:
     return "ChannelDepth";
+  case MessageType::ReadArrayFile:
+    return "ReadArrayFile";
+  case MessageType::ArrayFileError:
+    return "ArrayFileError";
   default:
     return "Unknown";
   }
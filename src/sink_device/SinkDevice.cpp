@@ -5,7 +5,11 @@
 
 #include "anari/anari_cpp.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cstring>
+#include <future>
+#include <thread>
 
 namespace sink_device {
 
@@ -13,6 +17,31 @@ namespace sink_device {
 // SinkDevice definitions /////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
+// Helper functions ///////////////////////////////////////////////////////////
+
+static void sleepFor(float milliseconds)
+{
+  if (milliseconds > 0.f) {
+    std::this_thread::sleep_for(
+        std::chrono::duration<float, std::milli>(milliseconds));
+  }
+}
+
+struct FrameData
+{
+  uint32_t width = 1;
+  uint32_t height = 1;
+  float duration = 0.f; // simulated render latency of the last frame, seconds
+  std::future<void> rendering;
+
+  void wait()
+  {
+    if (rendering.valid()) {
+      rendering.get();
+    }
+  }
+};
+
 // Data Arrays ////////////////////////////////////////////////////////////////
 
 void managed_deleter(const void *, const void *memory)
@@ -20,6 +49,35 @@ void managed_deleter(const void *, const void *memory)
   delete[] static_cast<char *>(const_cast<void *>(memory));
 }
 
+void SinkDevice::initArray(Object *obj,
+    const void *appMemory,
+    ANARIMemoryDeleter deleter,
+    const void *userData,
+    uint64_t size)
+{
+  obj->size = size;
+  if (appMemory == nullptr) {
+    obj->userdata = nullptr;
+    obj->memory = new char[size];
+    obj->deleter = managed_deleter;
+  } else if (costs.copyArrays) {
+    char *copy = new char[size];
+    std::memcpy(copy, appMemory, size);
+    if (deleter) {
+      deleter(userData, appMemory);
+    }
+    obj->userdata = nullptr;
+    obj->memory = copy;
+    obj->deleter = managed_deleter;
+    simulateUpload(size);
+  } else {
+    obj->userdata = userData;
+    obj->memory = appMemory;
+    obj->deleter = deleter;
+    simulateUpload(size);
+  }
+}
+
 ANARIArray1D SinkDevice::newArray1D(const void *appMemory,
     ANARIMemoryDeleter deleter,
     const void *userData,
@@ -28,15 +86,7 @@ ANARIArray1D SinkDevice::newArray1D(const void *appMemory,
 {
   ANARIArray1D handle = nextHandle<ANARIArray1D>();
   if (auto obj = getObject(handle)) {
-    if (appMemory == nullptr) {
-      obj->userdata = nullptr;
-      obj->memory = new char[sizeOf(type) * numItems];
-      obj->deleter = managed_deleter;
-    } else {
-      obj->userdata = userData;
-      obj->memory = appMemory;
-      obj->deleter = deleter;
-    }
+    initArray(obj, appMemory, deleter, userData, sizeOf(type) * numItems);
   }
   return handle;
 }
@@ -50,15 +100,11 @@ ANARIArray2D SinkDevice::newArray2D(const void *appMemory,
 {
   ANARIArray2D handle = nextHandle<ANARIArray2D>();
   if (auto obj = getObject(handle)) {
-    if (appMemory == nullptr) {
-      obj->userdata = nullptr;
-      obj->memory = new char[sizeOf(type) * numItems1 * numItems2];
-      obj->deleter = managed_deleter;
-    } else {
-      obj->userdata = userData;
-      obj->memory = appMemory;
-      obj->deleter = deleter;
-    }
+    initArray(obj,
+        appMemory,
+        deleter,
+        userData,
+        sizeOf(type) * numItems1 * numItems2);
   }
   return handle;
 }
@@ -73,15 +119,11 @@ ANARIArray3D SinkDevice::newArray3D(const void *appMemory,
 {
   ANARIArray3D handle = nextHandle<ANARIArray3D>();
   if (auto obj = getObject(handle)) {
-    if (appMemory == nullptr) {
-      obj->userdata = nullptr;
-      obj->memory = new char[sizeOf(type) * numItems1 * numItems2 * numItems3];
-      obj->deleter = managed_deleter;
-    } else {
-      obj->userdata = userData;
-      obj->memory = appMemory;
-      obj->deleter = deleter;
-    }
+    initArray(obj,
+        appMemory,
+        deleter,
+        userData,
+        sizeOf(type) * numItems1 * numItems2 * numItems3);
   }
   return handle;
 }
@@ -95,7 +137,12 @@ void *SinkDevice::mapArray(ANARIArray a)
   }
 }
 
-void SinkDevice::unmapArray(ANARIArray) {}
+void SinkDevice::unmapArray(ANARIArray a)
+{
+  if (auto obj = getObject(a)) {
+    simulateUpload(obj->size);
+  }
+}
 
 // Renderable Objects /////////////////////////////////////////////////////////
 
@@ -160,9 +207,25 @@ ANARIWorld SinkDevice::newWorld()
   return nextHandle<ANARIWorld>();
 }
 
-int SinkDevice::getProperty(
-    ANARIObject, const char *, ANARIDataType, void *, uint64_t, ANARIWaitMask)
+int SinkDevice::getProperty(ANARIObject object,
+    const char *name,
+    ANARIDataType type,
+    void *mem,
+    uint64_t size,
+    ANARIWaitMask mask)
 {
+  if (auto obj = getObject(object)) {
+    if (obj->type == ANARI_FRAME && type == ANARI_FLOAT32
+        && size >= sizeof(float) && std::strcmp("duration", name) == 0) {
+      FrameData *data =
+          static_cast<FrameData *>(const_cast<void *>(obj->userdata));
+      if (mask == ANARI_WAIT) {
+        data->wait();
+      }
+      std::memcpy(mem, &data->duration, sizeof(float));
+      return 1;
+    }
+  }
   return 0;
 }
 
@@ -209,22 +272,45 @@ const void *SinkDevice::getParameterInfo(ANARIDataType objectType,
 
 // Object + Parameter Lifetime Management /////////////////////////////////////
 
-struct FrameData
-{
-  uint32_t width = 1;
-  uint32_t height = 1;
-};
-
 void frame_deleter(const void *userdata, const void *memory)
 {
   delete[] static_cast<char *>(const_cast<void *>(memory));
   delete static_cast<FrameData *>(const_cast<void *>(userdata));
 }
 
+bool SinkDevice::setCostParameter(
+    const char *name, ANARIDataType type, const void *mem)
+{
+  // A null 'mem' resets the parameter to its default
+  const CostModel defaults;
+  const float *f = static_cast<const float *>(mem);
+  if (type == ANARI_FLOAT32 && std::strcmp("renderLatency", name) == 0) {
+    pendingCosts.renderLatency = f ? *f : defaults.renderLatency;
+  } else if (type == ANARI_FLOAT32 && std::strcmp("renderJitter", name) == 0) {
+    pendingCosts.renderJitter = f ? *f : defaults.renderJitter;
+  } else if (type == ANARI_FLOAT32
+      && std::strcmp("uploadThroughput", name) == 0) {
+    pendingCosts.uploadThroughput = f ? *f : defaults.uploadThroughput;
+  } else if (type == ANARI_FLOAT32 && std::strcmp("commitCost", name) == 0) {
+    pendingCosts.commitCost = f ? *f : defaults.commitCost;
+  } else if (type == ANARI_BOOL && std::strcmp("copyArrays", name) == 0) {
+    pendingCosts.copyArrays =
+        mem ? *static_cast<const bool *>(mem) : defaults.copyArrays;
+  } else if (type == ANARI_UINT32 && std::strcmp("seed", name) == 0) {
+    pendingCosts.seed =
+        mem ? *static_cast<const uint32_t *>(mem) : defaults.seed;
+  } else {
+    return false;
+  }
+  return true;
+}
+
 void SinkDevice::setParameter(
     ANARIObject object, const char *name, ANARIDataType type, const void *mem)
 {
-  if (auto obj = getObject(object)) {
+  if (handleIsDevice(object)) {
+    setCostParameter(name, type, mem);
+  } else if (auto obj = getObject(object)) {
     if (obj->type == ANARI_FRAME) {
       FrameData *data =
           static_cast<FrameData *>(const_cast<void *>(obj->userdata));
@@ -239,9 +325,24 @@ void SinkDevice::setParameter(
   }
 }
 
-void SinkDevice::unsetParameter(ANARIObject, const char *) {}
+void SinkDevice::unsetParameter(ANARIObject object, const char *name)
+{
+  if (handleIsDevice(object)) {
+    const ANARIDataType types[] = {ANARI_FLOAT32, ANARI_BOOL, ANARI_UINT32};
+    for (ANARIDataType type : types) {
+      if (setCostParameter(name, type, nullptr)) {
+        break;
+      }
+    }
+  }
+}
 
-void SinkDevice::unsetAllParameters(ANARIObject) {}
+void SinkDevice::unsetAllParameters(ANARIObject object)
+{
+  if (handleIsDevice(object)) {
+    pendingCosts = CostModel();
+  }
+}
 
 void *SinkDevice::mapParameterArray1D(ANARIObject object,
     const char *name,
@@ -297,7 +398,15 @@ void *SinkDevice::mapParameterArray3D(ANARIObject object,
 
 void SinkDevice::unmapParameterArray(ANARIObject object, const char *name) {}
 
-void SinkDevice::commitParameters(ANARIObject) {}
+void SinkDevice::commitParameters(ANARIObject object)
+{
+  if (handleIsDevice(object)) {
+    costs = pendingCosts;
+    rng.seed(costs.seed);
+  } else {
+    sleepFor(costs.commitCost);
+  }
+}
 
 void SinkDevice::release(ANARIObject object)
 {
@@ -333,7 +442,9 @@ const void *SinkDevice::frameBufferMap(ANARIFrame fb,
 {
   if (auto obj = getObject(fb)) {
     if (obj->type == ANARI_FRAME) {
-      const FrameData *data = static_cast<const FrameData *>(obj->userdata);
+      FrameData *data =
+          static_cast<FrameData *>(const_cast<void *>(obj->userdata));
+      data->wait();
       if (obj->memory == nullptr) {
         obj->memory = new char[data->width * data->height * 4 * sizeof(float)];
       }
@@ -355,10 +466,37 @@ ANARIRenderer SinkDevice::newRenderer(const char *)
   return nextHandle<ANARIRenderer>();
 }
 
-void SinkDevice::renderFrame(ANARIFrame) {}
+void SinkDevice::renderFrame(ANARIFrame frame)
+{
+  if (auto obj = getObject(frame)) {
+    if (obj->type == ANARI_FRAME) {
+      FrameData *data =
+          static_cast<FrameData *>(const_cast<void *>(obj->userdata));
+      data->wait();
+      const float latency = nextRenderLatency();
+      data->duration = latency / 1000.f;
+      if (latency > 0.f) {
+        data->rendering =
+            std::async(std::launch::async, [latency]() { sleepFor(latency); });
+      }
+    }
+  }
+}
 
-int SinkDevice::frameReady(ANARIFrame, ANARIWaitMask)
+int SinkDevice::frameReady(ANARIFrame frame, ANARIWaitMask mask)
 {
+  if (auto obj = getObject(frame)) {
+    if (obj->type == ANARI_FRAME) {
+      FrameData *data =
+          static_cast<FrameData *>(const_cast<void *>(obj->userdata));
+      if (mask == ANARI_WAIT) {
+        data->wait();
+      } else if (data->rendering.valid()) {
+        return data->rendering.wait_for(std::chrono::seconds(0))
+            == std::future_status::ready;
+      }
+    }
+  }
   return 1;
 }
 
@@ -366,6 +504,24 @@ void SinkDevice::discardFrame(ANARIFrame) {}
 
 // Other SinkDevice definitions ///////////////////////////////////////////////
 
+void SinkDevice::simulateUpload(uint64_t bytes) const
+{
+  if (costs.uploadThroughput > 0.f) {
+    sleepFor(float(bytes) / (costs.uploadThroughput * 1e3f));
+  }
+}
+
+float SinkDevice::nextRenderLatency()
+{
+  float latency = costs.renderLatency;
+  if (costs.renderJitter > 0.f) {
+    std::uniform_real_distribution<float> jitter(
+        -costs.renderJitter, costs.renderJitter);
+    latency += jitter(rng);
+  }
+  return std::max(latency, 0.f);
+}
+
 SinkDevice::SinkDevice(ANARILibrary library) : DeviceImpl(library)
 {
   nextHandle<ANARIObject>(); // insert a handle at 0
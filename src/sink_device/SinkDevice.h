@@ -10,6 +10,7 @@
 
 #include <map>
 #include <memory>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -157,12 +158,35 @@ struct SinkDevice : public anari::DeviceImpl, public helium::RefCounted
   ~SinkDevice() = default;
 
  private:
+  // Synthetic costs which let the sink stand in for a real back-end when
+  // testing how an application paces frames and hides latency. They are set
+  // as device parameters and take effect when the device is committed. Times
+  // are in milliseconds; the defaults make every call free.
+  struct CostModel
+  {
+    float renderLatency = 0.f; // time from renderFrame() to a ready frame
+    float renderJitter = 0.f; // latency varies uniformly by up to this much
+    float uploadThroughput = 0.f; // MB/s of array data, zero is unlimited
+    float commitCost = 0.f; // per commitParameters() on an object
+    bool copyArrays = false; // copy app memory on anariNewArray*()
+    uint32_t seed = 0; // of the jitter's random sequence
+  };
+
+  bool setCostParameter(const char *name, ANARIDataType type, const void *mem);
+  void simulateUpload(uint64_t bytes) const;
+  float nextRenderLatency();
+
+  CostModel pendingCosts;
+  CostModel costs;
+  std::mt19937 rng;
+
   struct Object
   {
     int64_t refcount = 1;
     ANARIMemoryDeleter deleter = nullptr;
     const void *userdata = nullptr;
     const void *memory = nullptr;
+    uint64_t size = 0; // bytes of array data
     ANARIDataType type;
 
     std::map<std::string, std::vector<char>> mappings;
@@ -201,6 +225,12 @@ struct SinkDevice : public anari::DeviceImpl, public helium::RefCounted
 
   std::vector<std::unique_ptr<Object>> objects;
 
+  void initArray(Object *obj,
+      const void *appMemory,
+      ANARIMemoryDeleter deleter,
+      const void *userData,
+      uint64_t size);
+
   template <typename T>
   T nextHandle()
   {
@@ -0,0 +1,88 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "bench_helium_common.h"
+// benchmark
+#include <benchmark/benchmark.h>
+
+namespace {
+
+using helium::AnariAny;
+
+void AnariAny_constructFloat(benchmark::State &state)
+{
+  float v = 1.f;
+  for (auto _ : state) {
+    AnariAny a(v);
+    benchmark::DoNotOptimize(a);
+  }
+}
+BENCHMARK(AnariAny_constructFloat);
+
+void AnariAny_constructMat4(benchmark::State &state)
+{
+  const helium::mat4 v = linalg::identity;
+  for (auto _ : state) {
+    AnariAny a(ANARI_FLOAT32_MAT4, &v);
+    benchmark::DoNotOptimize(a);
+  }
+}
+BENCHMARK(AnariAny_constructMat4);
+
+void AnariAny_constructString(benchmark::State &state)
+{
+  const char *v = "a_parameter_string_value";
+  for (auto _ : state) {
+    AnariAny a(ANARI_STRING, v);
+    benchmark::DoNotOptimize(a);
+  }
+}
+BENCHMARK(AnariAny_constructString);
+
+void AnariAny_constructObject(benchmark::State &state)
+{
+  bench::TestState s;
+  auto *obj = new bench::TestObject(&s);
+  for (auto _ : state) {
+    AnariAny a(ANARI_GEOMETRY, &obj);
+    benchmark::DoNotOptimize(a);
+  }
+  obj->refDec();
+}
+BENCHMARK(AnariAny_constructObject);
+
+void AnariAny_copyFloat(benchmark::State &state)
+{
+  AnariAny src(1.f);
+  for (auto _ : state) {
+    AnariAny a(src);
+    benchmark::DoNotOptimize(a);
+  }
+}
+BENCHMARK(AnariAny_copyFloat);
+
+void AnariAny_copyString(benchmark::State &state)
+{
+  AnariAny src(ANARI_STRING, "a_parameter_string_value");
+  for (auto _ : state) {
+    AnariAny a(src);
+    benchmark::DoNotOptimize(a);
+  }
+}
+BENCHMARK(AnariAny_copyString);
+
+void AnariAny_copyObject(benchmark::State &state)
+{
+  bench::TestState s;
+  auto *obj = new bench::TestObject(&s);
+  AnariAny src(ANARI_GEOMETRY, &obj);
+  for (auto _ : state) {
+    AnariAny a(src);
+    benchmark::DoNotOptimize(a);
+  }
+  src.reset();
+  obj->refDec();
+}
+BENCHMARK(AnariAny_copyObject);
+
+} // namespace
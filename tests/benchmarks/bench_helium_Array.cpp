@@ -0,0 +1,104 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "bench_helium_common.h"
+#include "helium/array/Array1D.h"
+// benchmark
+#include <benchmark/benchmark.h>
+// std
+#include <vector>
+
+namespace {
+
+using bench::TestState;
+using helium::Array1D;
+using helium::Array1DMemoryDescriptor;
+
+Array1D *newArray(TestState &s, size_t numItems, const void *appMemory)
+{
+  Array1DMemoryDescriptor md;
+  md.appMemory = appMemory;
+  md.elementType = ANARI_FLOAT32;
+  md.numItems = numItems;
+  return new Array1D(&s, md);
+}
+
+// Create and release a managed array of 'state.range(0)' floats. Deferred
+// reclamation is not enabled, so each release deletes the array right away
+// and deletion is included.
+void Array_createManaged(benchmark::State &state)
+{
+  TestState s;
+  for (auto _ : state) {
+    auto *a = newArray(s, state.range(0), nullptr);
+    a->commit();
+    a->refDec();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(float));
+}
+BENCHMARK(Array_createManaged)->Range(1 << 10, 16 << 20);
+
+// As above, but wrapping application memory which is not copied or freed
+void Array_createShared(benchmark::State &state)
+{
+  TestState s;
+  std::vector<float> data(state.range(0));
+  for (auto _ : state) {
+    auto *a = newArray(s, data.size(), data.data());
+    a->commit();
+    a->refDec();
+  }
+}
+BENCHMARK(Array_createShared)->Range(1 << 10, 16 << 20);
+
+void Array_mapUnmap(benchmark::State &state)
+{
+  TestState s;
+  auto *a = newArray(s, state.range(0), nullptr);
+  a->commit();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a->map());
+    a->unmap();
+  }
+  a->refDec();
+}
+BENCHMARK(Array_mapUnmap)->Range(1 << 10, 16 << 20);
+
+// Versioned maps copy the current data into a new version on the first map
+// after each flush
+void Array_mapNewVersionFlush(benchmark::State &state)
+{
+  TestState s;
+  auto *a = newArray(s, state.range(0), nullptr);
+  a->commit();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a->mapNewVersion());
+    a->unmap();
+    s.commitBufferFlush();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(float));
+  a->refDec();
+}
+BENCHMARK(Array_mapNewVersionFlush)->Range(1 << 10, 16 << 20);
+
+void Array_privatize(benchmark::State &state)
+{
+  TestState s;
+  std::vector<float> data(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto *a = newArray(s, data.size(), data.data());
+    a->commit();
+    state.ResumeTiming();
+
+    a->privatize();
+
+    state.PauseTiming();
+    a->refDec();
+    state.ResumeTiming();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(float));
+}
+BENCHMARK(Array_privatize)->Range(1 << 10, 16 << 20);
+
+} // namespace
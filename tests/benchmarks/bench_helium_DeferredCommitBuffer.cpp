@@ -0,0 +1,83 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "bench_helium_common.h"
+// benchmark
+#include <benchmark/benchmark.h>
+
+namespace {
+
+using bench::TestObject;
+using bench::TestState;
+
+std::vector<TestObject *> makeObjects(TestState &s, size_t n)
+{
+  std::vector<TestObject *> objs;
+  for (size_t i = 0; i < n; i++)
+    objs.push_back(new TestObject(&s, i % 2 ? ANARI_SURFACE : ANARI_GEOMETRY));
+  return objs;
+}
+
+void releaseObjects(const std::vector<TestObject *> &objs)
+{
+  for (auto *o : objs)
+    o->refDec();
+}
+
+// Queue 'state.range(0)' updated objects, then flush them through commit()
+void DeferredCommitBuffer_addFlush(benchmark::State &state)
+{
+  TestState s;
+  auto objs = makeObjects(s, state.range(0));
+  for (auto _ : state) {
+    for (auto *o : objs) {
+      o->markUpdated();
+      s.commitBufferAddObject(o);
+    }
+    s.commitBufferFlush();
+  }
+  state.SetItemsProcessed(state.iterations() * objs.size());
+  releaseObjects(objs);
+}
+BENCHMARK(DeferredCommitBuffer_addFlush)->Range(16, 16 << 10);
+
+// Same, but nothing changed since the last commit, so flush() only sorts and
+// skips them
+void DeferredCommitBuffer_addFlushUnchanged(benchmark::State &state)
+{
+  TestState s;
+  auto objs = makeObjects(s, state.range(0));
+  for (auto _ : state) {
+    for (auto *o : objs)
+      s.commitBufferAddObject(o);
+    s.commitBufferFlush();
+  }
+  state.SetItemsProcessed(state.iterations() * objs.size());
+  releaseObjects(objs);
+}
+BENCHMARK(DeferredCommitBuffer_addFlushUnchanged)->Range(16, 16 << 10);
+
+// One object notifying 'state.range(0)' observers, which queues each of them
+// in the commit buffer (cleared again without committing)
+void DeferredCommitBuffer_observerFanOut(benchmark::State &state)
+{
+  TestState s;
+  auto *source = new TestObject(&s, ANARI_ARRAY1D);
+  auto observers = makeObjects(s, state.range(0));
+  for (auto *o : observers)
+    source->addCommitObserver(o);
+
+  for (auto _ : state) {
+    source->notifyCommitObservers();
+    s.commitBufferClear();
+  }
+  state.SetItemsProcessed(state.iterations() * observers.size());
+
+  for (auto *o : observers)
+    source->removeCommitObserver(o);
+  source->refDec();
+  releaseObjects(observers);
+}
+BENCHMARK(DeferredCommitBuffer_observerFanOut)->Range(1, 4 << 10);
+
+} // namespace
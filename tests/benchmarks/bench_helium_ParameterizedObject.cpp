@@ -0,0 +1,77 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "bench_helium_common.h"
+// benchmark
+#include <benchmark/benchmark.h>
+
+namespace {
+
+using helium::ParameterizedObject;
+
+// Each benchmark touches all of an object's 'state.range(0)' parameters once
+// per iteration, items/s is parameter operations per second
+
+void setAll(ParameterizedObject &obj, size_t numParams)
+{
+  const auto &names = bench::paramNames();
+  for (size_t i = 0; i < numParams; i++)
+    obj.setParam(names[i], float(i));
+}
+
+void ParameterizedObject_set(benchmark::State &state)
+{
+  const size_t numParams = state.range(0);
+  ParameterizedObject obj;
+  setAll(obj, numParams);
+  for (auto _ : state)
+    setAll(obj, numParams);
+  state.SetItemsProcessed(state.iterations() * numParams);
+}
+BENCHMARK(ParameterizedObject_set)->Arg(10)->Arg(25)->Arg(50)->Arg(100);
+
+void ParameterizedObject_get(benchmark::State &state)
+{
+  const size_t numParams = state.range(0);
+  const auto &names = bench::paramNames();
+  ParameterizedObject obj;
+  setAll(obj, numParams);
+  for (auto _ : state) {
+    for (size_t i = 0; i < numParams; i++)
+      benchmark::DoNotOptimize(obj.getParam<float>(names[i], 0.f));
+  }
+  state.SetItemsProcessed(state.iterations() * numParams);
+}
+BENCHMARK(ParameterizedObject_get)->Arg(10)->Arg(25)->Arg(50)->Arg(100);
+
+void ParameterizedObject_getMissing(benchmark::State &state)
+{
+  const size_t numParams = state.range(0);
+  const auto &names = bench::paramNames();
+  ParameterizedObject obj;
+  setAll(obj, numParams);
+  for (auto _ : state) {
+    for (size_t i = 0; i < numParams; i++) {
+      benchmark::DoNotOptimize(
+          obj.getParam<float>(names[names.size() - 1 - i], 0.f));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * numParams);
+}
+BENCHMARK(ParameterizedObject_getMissing)->Arg(10)->Arg(25);
+
+void ParameterizedObject_setRemove(benchmark::State &state)
+{
+  const size_t numParams = state.range(0);
+  const auto &names = bench::paramNames();
+  ParameterizedObject obj;
+  for (auto _ : state) {
+    setAll(obj, numParams);
+    for (size_t i = 0; i < numParams; i++)
+      obj.removeParam(names[i]);
+  }
+  state.SetItemsProcessed(state.iterations() * numParams * 2);
+}
+BENCHMARK(ParameterizedObject_setRemove)->Arg(10)->Arg(25)->Arg(50)->Arg(100);
+
+} // namespace
@@ -0,0 +1,52 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "helium/utility/IntrusivePtr.h"
+// benchmark
+#include <benchmark/benchmark.h>
+
+namespace {
+
+using helium::RefCounted;
+using helium::RefType;
+
+void RefCounted_incDec(benchmark::State &state)
+{
+  auto *obj = new RefCounted();
+  for (auto _ : state) {
+    obj->refInc(RefType::INTERNAL);
+    obj->refDec(RefType::INTERNAL);
+  }
+  obj->refDec();
+}
+BENCHMARK(RefCounted_incDec);
+
+// All threads share one object, as when many rendering threads hold
+// references to the same scene object
+void RefCounted_incDecContended(benchmark::State &state)
+{
+  static RefCounted *obj = nullptr;
+  if (state.thread_index() == 0)
+    obj = new RefCounted();
+  for (auto _ : state) {
+    obj->refInc(RefType::INTERNAL);
+    obj->refDec(RefType::INTERNAL);
+  }
+  if (state.thread_index() == 0)
+    obj->refDec();
+}
+BENCHMARK(RefCounted_incDecContended)->ThreadRange(1, 8)->UseRealTime();
+
+void RefCounted_intrusivePtrCopy(benchmark::State &state)
+{
+  auto *obj = new RefCounted();
+  helium::IntrusivePtr<RefCounted> src = obj;
+  obj->refDec();
+  for (auto _ : state) {
+    helium::IntrusivePtr<RefCounted> p = src;
+    benchmark::DoNotOptimize(p);
+  }
+}
+BENCHMARK(RefCounted_intrusivePtrCopy);
+
+} // namespace
@@ -0,0 +1,17 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "helium/utility/TimeStamp.h"
+// benchmark
+#include <benchmark/benchmark.h>
+
+namespace {
+
+void TimeStamp_new(benchmark::State &state)
+{
+  for (auto _ : state)
+    benchmark::DoNotOptimize(helium::newTimeStamp());
+}
+BENCHMARK(TimeStamp_new)->ThreadRange(1, 8)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,28 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "helium_test_common.h"
+// std
+#include <string>
+#include <vector>
+
+namespace bench {
+
+using helium_test::TestObject;
+using helium_test::TestState;
+
+// Parameter names are built up front so their construction is not measured
+inline const std::vector<std::string> &paramNames()
+{
+  static std::vector<std::string> names = []() {
+    std::vector<std::string> n;
+    for (int i = 0; i < 128; i++)
+      n.push_back("param" + std::to_string(i));
+    return n;
+  }();
+  return names;
+}
+
+} // namespace bench
@@ -0,0 +1,43 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "helium/BaseGlobalDeviceState.h"
+#include "helium/BaseObject.h"
+
+// Shared by the unit tests and benchmarks, which exercise helium without a
+// device implementation behind it
+namespace helium_test {
+
+// Device state without a device: messages are dropped
+struct TestState : public helium::BaseGlobalDeviceState
+{
+  TestState() : helium::BaseGlobalDeviceState(nullptr) {}
+};
+
+// Minimal concrete object, commit() does no work so only helium is exercised
+struct TestObject : public helium::BaseObject
+{
+  TestObject(
+      helium::BaseGlobalDeviceState *s, ANARIDataType type = ANARI_GEOMETRY)
+      : helium::BaseObject(type, s)
+  {}
+
+  bool getProperty(const std::string_view &,
+      ANARIDataType,
+      void *,
+      uint32_t) override
+  {
+    return false;
+  }
+
+  void commit() override {}
+
+  bool isValid() const override
+  {
+    return true;
+  }
+};
+
+} // namespace helium_test
@@ -0,0 +1,54 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "catch.hpp"
+
+#include "helium/utility/EpochTracker.h"
+
+namespace {
+
+SCENARIO("helium::EpochTracker interface", "[helium_EpochTracker]")
+{
+  GIVEN("An EpochTracker with a reader pinned to the current epoch")
+  {
+    helium::EpochTracker epochs;
+    auto pinned = epochs.pin();
+
+    int numReleased = 0;
+    epochs.retire([&]() { numReleased++; });
+
+    THEN("Data retired at the pinned epoch is not released")
+    {
+      REQUIRE(numReleased == 0);
+      REQUIRE(epochs.numRetired() == 1);
+      REQUIRE(epochs.numPinned() == 1);
+    }
+
+    WHEN("A new epoch starts and a reader pins it")
+    {
+      epochs.advance();
+      auto next = epochs.pin();
+      REQUIRE(next == pinned + 1);
+
+      THEN("Unpinning the older epoch releases the retired data")
+      {
+        epochs.unpin(pinned);
+        REQUIRE(numReleased == 1);
+        REQUIRE(epochs.numRetired() == 0);
+      }
+
+      epochs.unpin(next);
+    }
+
+    epochs.unpin(pinned);
+
+    THEN("Data retired without pinned readers is released right away")
+    {
+      REQUIRE(numReleased == 1);
+      epochs.retire([&]() { numReleased++; });
+      REQUIRE(numReleased == 2);
+    }
+  }
+}
+
+} // namespace
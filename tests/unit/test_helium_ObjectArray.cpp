@@ -0,0 +1,133 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "catch.hpp"
+
+#include "helium_test_common.h"
+#include "helium/array/ObjectArray.h"
+
+namespace {
+
+using helium_test::TestObject;
+using helium_test::TestState;
+
+uint32_t internalRefs(const helium::BaseObject *o)
+{
+  return o->useCount(helium::RefType::INTERNAL);
+}
+
+SCENARIO("helium::ObjectArray handle tracking", "[helium_ObjectArray]")
+{
+  TestState state;
+
+  TestObject *a = new TestObject(&state);
+  TestObject *b = new TestObject(&state);
+  TestObject *c = new TestObject(&state);
+
+  GIVEN("A managed ObjectArray of three slots")
+  {
+    helium::Array1DMemoryDescriptor md;
+    md.elementType = ANARI_GEOMETRY;
+    md.numItems = 3;
+    auto *array = new helium::ObjectArray(&state, md);
+
+    auto setHandles = [&](helium::BaseObject *h0,
+                          helium::BaseObject *h1,
+                          helium::BaseObject *h2) {
+      auto **handles = (helium::BaseObject **)array->map();
+      handles[0] = h0;
+      handles[1] = h1;
+      handles[2] = h2;
+      array->unmap();
+    };
+
+    setHandles(a, b, nullptr);
+
+    THEN("Each stored handle holds one internal reference")
+    {
+      REQUIRE(internalRefs(a) == 1);
+      REQUIRE(internalRefs(b) == 1);
+      REQUIRE(internalRefs(c) == 0);
+      REQUIRE(array->handlesBegin()[0] == a);
+      REQUIRE(array->handlesBegin()[1] == b);
+      REQUIRE(array->handlesBegin()[2] == nullptr);
+    }
+
+    WHEN("One slot is replaced")
+    {
+      setHandles(a, c, nullptr);
+
+      THEN("Only the old and new handle of that slot change ref counts")
+      {
+        REQUIRE(internalRefs(a) == 1);
+        REQUIRE(internalRefs(b) == 0);
+        REQUIRE(internalRefs(c) == 1);
+        REQUIRE(array->handlesBegin()[1] == c);
+      }
+    }
+
+    WHEN("A handle is appended and then removed")
+    {
+      array->appendHandle(c);
+
+      THEN("It follows the app handles and holds a reference")
+      {
+        REQUIRE(array->totalSize() == 4);
+        REQUIRE(array->handlesBegin()[3] == c);
+        REQUIRE(internalRefs(c) == 1);
+      }
+
+      array->removeAppendedHandles();
+
+      THEN("Its reference is released")
+      {
+        REQUIRE(array->totalSize() == 3);
+        REQUIRE(internalRefs(c) == 0);
+      }
+    }
+
+    WHEN("The array is narrowed with 'begin' and a handle is appended")
+    {
+      array->setParam("begin", size_t(1));
+      array->commit();
+      array->appendHandle(c);
+
+      THEN("Live handles start at 'begin' and end with the appended handle")
+      {
+        REQUIRE(array->totalSize() == 3);
+        REQUIRE(array->handlesBegin()[0] == b);
+        REQUIRE(array->handlesBegin()[1] == nullptr);
+        REQUIRE(array->handlesBegin()[2] == c);
+      }
+    }
+
+    WHEN("An empty range is committed")
+    {
+      array->setParam("begin", size_t(2));
+      array->setParam("end", size_t(2));
+      array->commit();
+
+      THEN("The previous range and its live handles are kept")
+      {
+        REQUIRE(array->totalSize() == 3);
+        REQUIRE(array->handlesBegin()[0] == a);
+        REQUIRE(array->handlesBegin()[1] == b);
+      }
+    }
+
+    array->refDec(helium::RefType::PUBLIC);
+
+    THEN("Releasing the array releases every reference it held")
+    {
+      REQUIRE(internalRefs(a) == 0);
+      REQUIRE(internalRefs(b) == 0);
+      REQUIRE(internalRefs(c) == 0);
+    }
+  }
+
+  a->refDec(helium::RefType::PUBLIC);
+  b->refDec(helium::RefType::PUBLIC);
+  c->refDec(helium::RefType::PUBLIC);
+}
+
+} // namespace
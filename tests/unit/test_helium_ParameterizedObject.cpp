@@ -80,6 +80,28 @@ SCENARIO(
         REQUIRE(v2 == 0);
       }
     }
+
+    WHEN("The parameter is set again")
+    {
+      int same = v;
+      int different = v + 1;
+
+      THEN("Only a different value is reported as a change")
+      {
+        REQUIRE(!obj.setParam(name, ANARI_INT32, &same));
+        REQUIRE(!obj.setParam(name, same));
+        REQUIRE(obj.setParam(name, ANARI_INT32, &different));
+        REQUIRE(obj.getParam<int>(name, 4) == different);
+        REQUIRE(obj.setParam(name, float(different)));
+      }
+    }
+
+    THEN("Removing reports whether there was a parameter to remove")
+    {
+      REQUIRE(obj.removeParam(name));
+      REQUIRE(!obj.removeParam(name));
+      REQUIRE(!obj.removeAllParams());
+    }
   }
 
   GIVEN("A ParameterizedObject with a string parameter")
@@ -103,6 +125,12 @@ SCENARIO(
       REQUIRE(obj.getParam<short>(name, 4) == 4);
     }
 
+    THEN("Setting the same string again is not a change")
+    {
+      REQUIRE(!obj.setParam(name, std::string(testStr)));
+      REQUIRE(obj.setParam(name, std::string("other")));
+    }
+
     WHEN("The parameter is removed")
     {
       obj.removeParam(name);
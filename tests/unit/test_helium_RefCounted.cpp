@@ -31,10 +31,14 @@
 
 #include "catch.hpp"
 
+#include "helium/utility/DeferredReclamationQueue.h"
 #include "helium/utility/IntrusivePtr.h"
+// std
+#include <atomic>
 
 namespace {
 
+using helium::DeferredReclamationQueue;
 using helium::IntrusivePtr;
 using helium::RefCounted;
 using helium::RefType;
@@ -144,4 +148,59 @@ SCENARIO("helium::RefCounted interface", "[helium_RefCounted]")
   }
 }
 
+struct ReclaimedObject : public RefCounted
+{
+  ReclaimedObject(DeferredReclamationQueue &q, std::atomic<int> &n)
+      : queue(q), numDeleted(n)
+  {}
+  ~ReclaimedObject() override
+  {
+    numDeleted++;
+  }
+
+  DeferredReclamationQueue &queue;
+  std::atomic<int> &numDeleted;
+
+ protected:
+  void onLastReferenceReleased() const override
+  {
+    queue.reclaim(this);
+  }
+};
+
+SCENARIO("DeferredReclamationQueue deletes released objects", "[helium_RefCounted]")
+{
+  GIVEN("Objects which defer their deletion to a reclamation queue")
+  {
+    DeferredReclamationQueue queue;
+    std::atomic<int> numDeleted{0};
+
+    auto *a = new ReclaimedObject(queue, numDeleted);
+    auto *b = new ReclaimedObject(queue, numDeleted);
+    b->refInc(RefType::INTERNAL);
+
+    WHEN("Only some of the objects have their last reference released")
+    {
+      a->refDec();
+      b->refDec();
+      queue.wait();
+
+      THEN("Only those objects are deleted")
+      {
+        REQUIRE(numDeleted == 1);
+        REQUIRE(queue.size() == 0);
+        REQUIRE(b->useCount() == 1);
+      }
+
+      b->refDec(RefType::INTERNAL);
+      queue.wait();
+
+      THEN("Releasing the remaining reference deletes the last object")
+      {
+        REQUIRE(numDeleted == 2);
+      }
+    }
+  }
+}
+
 } // namespace